@@ -3,12 +3,19 @@
 #include "astronomy/orbital_elements.hpp"
 
 #include <algorithm>
+#include <cstdint>
+#include <future>
+#include <map>
+#include <thread>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "absl/strings/str_cat.h"
+#include "absl/synchronization/mutex.h"
 #include "base/jthread.hpp"
 #include "base/status_utilities.hpp"  // 🧙 For RETURN_IF_ERROR.
+#include "base/thread_pool.hpp"
 #include "integrators/embedded_explicit_runge_kutta_integrator.hpp"
 #include "integrators/integrators.hpp"
 #include "integrators/methods.hpp"
@@ -26,6 +33,7 @@ namespace _orbital_elements {
 namespace internal {
 
 using namespace principia::base::_jthread;
+using namespace principia::base::_thread_pool;
 using namespace principia::integrators::_embedded_explicit_runge_kutta_integrator;  // NOLINT
 using namespace principia::integrators::_integrators;
 using namespace principia::integrators::_methods;
@@ -44,6 +52,44 @@ constexpr int max_clenshaw_curtis_points = 2000;
 constexpr double max_clenshaw_curtis_relative_error_for_initial_integration =
     1.0e-8;
 constexpr Length eerk_a_tolerance = 10 * Milli(Metre);
+// The number of osculating elements computed by each task when they are
+// computed in parallel.
+constexpr std::int64_t osculating_elements_per_task = 64;
+
+// The pool used to compute the osculating elements and the quadratures.  Never
+// destroyed, as it may be used during static destruction.
+inline ThreadPool<void>& OrbitalElementsPool() {
+  static auto* const pool = new ThreadPool<void>(
+      std::max(1u, std::thread::hardware_concurrency()));
+  return *pool;
+}
+
+// Returns the values of |f| at each of the |arguments|, computed in parallel.
+// |f| must be thread-safe.
+template<typename Argument, typename Function>
+std::vector<std::invoke_result_t<Function, Argument>> ParallelMap(
+    Function const& f,
+    std::vector<Argument> const& arguments) {
+  std::vector<std::invoke_result_t<Function, Argument>> values(
+      arguments.size());
+  std::vector<std::future<void>> futures;
+  for (std::int64_t begin = 0;
+       begin < arguments.size();
+       begin += osculating_elements_per_task) {
+    futures.push_back(OrbitalElementsPool().Add(
+        [begin, &arguments, &f, &values]() {
+          std::int64_t const end = std::min<std::int64_t>(
+              begin + osculating_elements_per_task, arguments.size());
+          for (std::int64_t i = begin; i < end; ++i) {
+            values[i] = f(arguments[i]);
+          }
+        }));
+  }
+  for (auto& future : futures) {
+    future.get();
+  }
+  return values;
+}
 
 template<typename Inertial, typename PrimaryCentred>
 absl::StatusOr<OrbitalElements> OrbitalElements::ForTrajectory(
@@ -192,15 +238,18 @@ absl::StatusOr<OrbitalElements> OrbitalElements::ForRelativeDegreesOfFreedom(
                                  DebugString(estimated_period));
   }
 
-  std::vector<Angle> unwound_λs;
   // 3 is greater than 2 to make sure that we start in the right direction.
   Time const third_of_estimated_period = estimated_period / 3;
-  unwound_λs.reserve(std::floor((t_max - t_min) / third_of_estimated_period) +
-                     1);
+  std::vector<Instant> λ_times;
+  λ_times.reserve(std::floor((t_max - t_min) / third_of_estimated_period) + 1);
   for (Instant t = t_min; t <= t_max; t += third_of_estimated_period) {
-    Angle const λ = wound_osculating_λ(t);
-    unwound_λs.push_back(unwound_λs.empty() ? λ
-                                            : UnwindFrom(unwound_λs.back(), λ));
+    λ_times.push_back(t);
+  }
+  // The osculating elements are computed in parallel, but the unwinding is
+  // sequential.
+  std::vector<Angle> unwound_λs = ParallelMap(wound_osculating_λ, λ_times);
+  for (std::int64_t i = 1; i < unwound_λs.size(); ++i) {
+    unwound_λs[i] = UnwindFrom(unwound_λs[i - 1], unwound_λs[i]);
   }
 
   auto const osculating_equinoctial_elements =
@@ -249,13 +298,15 @@ absl::StatusOr<OrbitalElements> OrbitalElements::ForRelativeDegreesOfFreedom(
       std::move(mean_equinoctial_elements).value();
 
   if (fill_osculating_equinoctial_elements) {
+    std::vector<Instant> times;
     for (Instant t = t_min;
          t <= t_max;
          t += orbital_elements.sidereal_period_ /
               osculating_equinoctial_elements_per_sidereal_period) {
-      orbital_elements.osculating_equinoctial_elements_.push_back(
-          osculating_equinoctial_elements(t));
+      times.push_back(t);
     }
+    orbital_elements.osculating_equinoctial_elements_ =
+        ParallelMap(osculating_equinoctial_elements, times);
   }
 
   if (orbital_elements.mean_equinoctial_elements_.size() < 2) {
@@ -291,7 +342,8 @@ absl::StatusOr<Time> OrbitalElements::SiderealPeriod(
       t_min,
       t_max,
       max_clenshaw_curtis_relative_error,
-      max_clenshaw_curtis_points);
+      max_clenshaw_curtis_points,
+      OrbitalElementsPool());
   return 2 * π * Radian * Pow<3>(Δt) / (12 * ʃ_λt_dt);
 }
 
@@ -378,16 +430,39 @@ OrbitalElements::MeanEquinoctialElements(
     return std::max(0.5, braking_factor * eerk_a_tolerance / Abs(Δa));
   };
 
+  // The quadratures of the different elements use the same nodes, so the
+  // osculating elements at a node are only computed once, by the first
+  // quadrature that needs them.  The nodes of a refinement are computed in
+  // parallel.
+  absl::Mutex nodes_lock;
+  std::map<Instant, EquinoctialElements> elements_at_nodes;
+  auto const memoized_equinoctial_elements =
+      [&equinoctial_elements, &elements_at_nodes, &nodes_lock](
+          Instant const& t) -> EquinoctialElements {
+    {
+      absl::ReaderMutexLock l(&nodes_lock);
+      if (auto const it = elements_at_nodes.find(t);
+          it != elements_at_nodes.end()) {
+        return it->second;
+      }
+    }
+    EquinoctialElements const elements = equinoctial_elements(t);
+    absl::MutexLock l(&nodes_lock);
+    elements_at_nodes.emplace(t, elements);
+    return elements;
+  };
+
   auto const initial_integration =
-      [&equinoctial_elements, period, t_min](auto const element) {
+      [&memoized_equinoctial_elements, period, t_min](auto const element) {
         return AutomaticClenshawCurtis(
-                   [element, &equinoctial_elements](Instant const& t) {
-                     return equinoctial_elements(t).*element;
+                   [element, &memoized_equinoctial_elements](Instant const& t) {
+                     return memoized_equinoctial_elements(t).*element;
                    },
                    t_min,
                    t_min + period,
                    max_clenshaw_curtis_relative_error_for_initial_integration,
-                   /*max_points=*/max_clenshaw_curtis_points) /
+                   /*max_points=*/max_clenshaw_curtis_points,
+                   OrbitalElementsPool()) /
                period;
       };
 
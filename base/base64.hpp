@@ -14,7 +14,8 @@ using namespace principia::base::_array;
 using namespace principia::base::_encoder;
 
 // This function implements RFC 4648 section 5 (base64url).  The encoded text is
-// *not* padded.
+// *not* padded.  The input and output of |Encode| and |Decode| must not
+// overlap.
 template<bool null_terminated>
 class Base64Encoder : public Encoder<char, null_terminated> {
  public:
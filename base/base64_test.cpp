@@ -1,8 +1,10 @@
 #include "base/base64.hpp"
 
 #include <cstdint>
+#include <random>
 #include <string>
 
+#include "absl/strings/escaping.h"
 #include "base/array.hpp"
 #include "gtest/gtest.h"
 
@@ -53,5 +55,30 @@ TEST_F(Base64Test, WellKnownData) {
   }
 }
 
+// Compares the (possibly vectorized) encoder with the scalar implementation of
+// Abseil, on sizes that exercise both the vectors and the remainders.
+TEST_F(Base64Test, Fuzz) {
+  std::mt19937_64 random(42);
+  std::uniform_int_distribution<int> byte_distribution(0, 255);
+  for (std::int64_t size = 1; size < 200; ++size) {
+    std::string decoded_string(size, '\0');
+    for (auto& c : decoded_string) {
+      c = static_cast<char>(byte_distribution(random));
+    }
+    std::string encoded_string;
+    absl::WebSafeBase64Escape(decoded_string, &encoded_string);
+
+    Array<std::uint8_t const> const decoded_array(
+        reinterpret_cast<std::uint8_t const*>(decoded_string.data()),
+        decoded_string.size());
+    auto const encoded_array = encoder_.Encode(decoded_array);
+    EXPECT_EQ(Array<char const>(encoded_string), encoded_array.get()) << size;
+
+    auto const decoded_array_again =
+        encoder_.Decode(Array<char const>(encoded_string));
+    EXPECT_EQ(decoded_array, decoded_array_again.get()) << size;
+  }
+}
+
 }  // namespace base
 }  // namespace principia
@@ -67,6 +67,7 @@ PRINCIPIA_CPUID_FLAG(PSN, 0x01, EDX, 18);     // Processor Serial Number.
 PRINCIPIA_CPUID_FLAG(SSE, 0x01, EDX, 25);     // Streaming SIMD Extensions.
 PRINCIPIA_CPUID_FLAG(SSE2, 0x01, EDX, 26);    // Streaming SIMD Extensions 2.
 PRINCIPIA_CPUID_FLAG(SSE3, 0x01, ECX, 0);     // Streaming SIMD Extensions 3.
+PRINCIPIA_CPUID_FLAG(SSSE3, 0x01, ECX, 9);    // Supplemental SSE3.
 PRINCIPIA_CPUID_FLAG(FMA, 0x01, ECX, 12);     // Fused Multiply Add.
 PRINCIPIA_CPUID_FLAG(SSE4_1, 0x01, ECX, 19);  // Streaming SIMD Extensions 4.1.
 PRINCIPIA_CPUID_FLAG(AVX, 0x01, ECX, 28);     // Advanced Vector eXtensions.
@@ -28,6 +28,7 @@ class CPUIDFeatureFlag {
   static const CPUIDFeatureFlag SSE;       // Streaming SIMD Extensions.
   static const CPUIDFeatureFlag SSE2;      // Streaming SIMD Extensions 2.
   static const CPUIDFeatureFlag SSE3;      // Streaming SIMD Extensions 3.
+  static const CPUIDFeatureFlag SSSE3;     // Supplemental SSE3.
 
   static const CPUIDFeatureFlag FMA;          // Fused Multiply Add.
   static const CPUIDFeatureFlag SSE4_1;       // Streaming SIMD Extensions 4.1.
@@ -3,6 +3,8 @@
 #include <cstdint>
 
 #include "base/array.hpp"
+#include "base/cpuid.hpp"
+#include "base/macros.hpp"  // 🧙 For PRINCIPIA_MAY_USE_SSSE3_INTRINSICS.
 
 namespace principia {
 namespace base {
@@ -10,6 +12,18 @@ namespace _encoder {
 namespace internal {
 
 using namespace principia::base::_array;
+using namespace principia::base::_cpuid;
+
+// Whether the encoders may use their SSSE3 implementations.  They produce the
+// same results as the scalar ones.
+inline bool UseSSSE3() {
+#if PRINCIPIA_MAY_USE_SSSE3_INTRINSICS()
+  static bool const use_ssse3 = CPUIDFeatureFlag::SSSE3.IsSet();
+  return use_ssse3;
+#else
+  return false;
+#endif
+}
 
 // Encodes/decodes an array of bytes to/from an array of Char.  If
 // |null_terminated| is true a null Char is appended to the encoded form and
@@ -47,6 +61,7 @@ class Encoder {
 }  // namespace internal
 
 using internal::Encoder;
+using internal::UseSSSE3;
 
 }  // namespace _encoder
 }  // namespace base
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <cstdint>
+#include <limits>
 #include <memory>
 
+#include "absl/synchronization/mutex.h"
 #include "base/thread_pool.hpp"
 
 namespace principia {
@@ -12,14 +14,29 @@ namespace internal {
 
 using namespace principia::base::_thread_pool;
 
+// A place where objects that are slow to destroy (e.g., because they own
+// threads that must be joined) may be buried, to be destroyed asynchronously.
+// This class is thread-safe.
 class Graveyard {
  public:
-  explicit Graveyard(std::int64_t number_of_threads);
+  // At most |max_pending_burials| objects may be waiting to be destroyed; once
+  // that limit is reached, |Bury| blocks until some of them are destroyed.
+  explicit Graveyard(
+      std::int64_t number_of_threads,
+      std::int64_t max_pending_burials =
+          std::numeric_limits<std::int64_t>::max());
+
+  // Waits until all the buried objects have been destroyed.
+  ~Graveyard();
 
   template<typename T>
   void Bury(std::unique_ptr<T> t);
 
  private:
+  std::int64_t const max_pending_burials_;
+  absl::Mutex lock_;
+  std::int64_t pending_burials_ GUARDED_BY(lock_) = 0;
+
   ThreadPool<void> gravedigger_;
 };
 
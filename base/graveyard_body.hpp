@@ -9,15 +9,39 @@ namespace base {
 namespace _graveyard {
 namespace internal {
 
-inline Graveyard::Graveyard(std::int64_t const number_of_threads)
-    : gravedigger_(number_of_threads) {}
+inline Graveyard::Graveyard(std::int64_t const number_of_threads,
+                            std::int64_t const max_pending_burials)
+    : max_pending_burials_(max_pending_burials),
+      gravedigger_(number_of_threads) {}
+
+inline Graveyard::~Graveyard() {
+  // The |ThreadPool| drops the calls that are still queued when it is
+  // destroyed, so we must wait for them here lest the objects leak.
+  absl::MutexLock l(&lock_);
+  auto const all_buried = [this]() {
+    lock_.AssertReaderHeld();
+    return pending_burials_ == 0;
+  };
+  lock_.Await(absl::Condition(&all_buried));
+}
 
 template<typename T>
 void Graveyard::Bury(std::unique_ptr<T> t) {
+  {
+    absl::MutexLock l(&lock_);
+    auto const has_room = [this]() {
+      lock_.AssertReaderHeld();
+      return pending_burials_ < max_pending_burials_;
+    };
+    lock_.Await(absl::Condition(&has_room));
+    ++pending_burials_;
+  }
   // TODO(egg): Investigate the possibility of a mutable lambda with
   // std::packaged_task in the ThreadPool instead of std::function.
-  gravedigger_.Add([coffin = t.release()]() {
+  gravedigger_.Add([this, coffin = t.release()]() {
     delete coffin;
+    absl::MutexLock l(&lock_);
+    --pending_burials_;
   });
 }
 
@@ -0,0 +1,57 @@
+#include "base/graveyard.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+namespace principia {
+namespace base {
+
+using namespace principia::base::_graveyard;
+using namespace std::chrono_literals;
+
+class GraveyardTest : public ::testing::Test {
+ protected:
+  // An object that is slow to destroy and counts its destructions.
+  class Corpse final {
+   public:
+    explicit Corpse(std::atomic_int& destructions)
+        : destructions_(destructions) {}
+
+    ~Corpse() {
+      std::this_thread::sleep_for(1ms);
+      ++destructions_;
+    }
+
+   private:
+    std::atomic_int& destructions_;
+  };
+
+  std::atomic_int destructions_ = 0;
+};
+
+TEST_F(GraveyardTest, Flush) {
+  {
+    Graveyard graveyard(/*number_of_threads=*/4);
+    for (int i = 0; i < 100; ++i) {
+      graveyard.Bury(std::make_unique<Corpse>(destructions_));
+    }
+  }
+  // All the objects were destroyed by the destructor of the graveyard.
+  EXPECT_EQ(100, destructions_);
+}
+
+TEST_F(GraveyardTest, Bounded) {
+  Graveyard graveyard(/*number_of_threads=*/1, /*max_pending_burials=*/2);
+  for (int i = 0; i < 10; ++i) {
+    graveyard.Bury(std::make_unique<Corpse>(destructions_));
+    // At most two objects are waiting to be destroyed after a burial.
+    EXPECT_LE(i + 1 - 2, destructions_);
+  }
+}
+
+}  // namespace base
+}  // namespace principia
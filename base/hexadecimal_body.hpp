@@ -5,6 +5,11 @@
 #include <cstdint>
 #include <cstring>
 
+#if PRINCIPIA_MAY_USE_SSSE3_INTRINSICS()
+#include <tmmintrin.h>
+#endif
+
+#include "base/macros.hpp"  // 🧙 For PRINCIPIA_MAY_USE_SSSE3_INTRINSICS.
 #include "glog/logging.h"
 
 namespace principia {
@@ -38,6 +43,62 @@ constexpr std::uint8_t hexadecimal_digits_to_nibble[256] = {
 #undef SKIP_48
 #endif
 
+#if PRINCIPIA_MAY_USE_SSSE3_INTRINSICS()
+
+// Encodes the 16 bytes at |input| into the 32 digits at |output|.  All the
+// input is read before the output is written.
+inline void EncodeSSSE3(std::uint8_t const* const input, char* const output) {
+  __m128i const digits = _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7',
+                                       '8', '9', 'A', 'B', 'C', 'D', 'E', 'F');
+  __m128i const nibble_mask = _mm_set1_epi8(0x0F);
+  __m128i const bytes =
+      _mm_loadu_si128(reinterpret_cast<__m128i const*>(input));
+  __m128i const high_digits = _mm_shuffle_epi8(
+      digits, _mm_and_si128(_mm_srli_epi16(bytes, 4), nibble_mask));
+  __m128i const low_digits =
+      _mm_shuffle_epi8(digits, _mm_and_si128(bytes, nibble_mask));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(output),
+                   _mm_unpacklo_epi8(high_digits, low_digits));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 16),
+                   _mm_unpackhi_epi8(high_digits, low_digits));
+}
+
+// Returns the nibbles of the 16 digits in |digits|, with the same semantics as
+// |hexadecimal_digits_to_nibble|.
+inline __m128i DigitsToNibblesSSSE3(__m128i const digits) {
+  // The comparisons are signed, so the non-ASCII characters are never in
+  // range.  Setting bit 5 maps the upper-case letters to lower-case ones, and
+  // doesn't bring any other character in the range [a, f].
+  __m128i const lower_case = _mm_or_si128(digits, _mm_set1_epi8(0x20));
+  __m128i const is_decimal =
+      _mm_and_si128(_mm_cmpgt_epi8(digits, _mm_set1_epi8('0' - 1)),
+                    _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), digits));
+  __m128i const is_letter =
+      _mm_and_si128(_mm_cmpgt_epi8(lower_case, _mm_set1_epi8('a' - 1)),
+                    _mm_cmpgt_epi8(_mm_set1_epi8('f' + 1), lower_case));
+  return _mm_or_si128(
+      _mm_and_si128(is_decimal, _mm_sub_epi8(digits, _mm_set1_epi8('0'))),
+      _mm_and_si128(is_letter,
+                    _mm_sub_epi8(lower_case, _mm_set1_epi8('a' - 10))));
+}
+
+// Decodes the 32 digits at |input| into the 16 bytes at |output|.  All the
+// input is read before the output is written.
+inline void DecodeSSSE3(char const* const input, std::uint8_t* const output) {
+  __m128i const first_nibbles = DigitsToNibblesSSSE3(
+      _mm_loadu_si128(reinterpret_cast<__m128i const*>(input)));
+  __m128i const second_nibbles = DigitsToNibblesSSSE3(
+      _mm_loadu_si128(reinterpret_cast<__m128i const*>(input + 16)));
+  // Each pair of nibbles (h, l) becomes the 16-bit integer 16 h + l.
+  __m128i const weights = _mm_set1_epi16(0x0110);
+  _mm_storeu_si128(
+      reinterpret_cast<__m128i*>(output),
+      _mm_packus_epi16(_mm_maddubs_epi16(first_nibbles, weights),
+                       _mm_maddubs_epi16(second_nibbles, weights)));
+}
+
+#endif
+
 template<bool null_terminated>
 void HexadecimalEncoder<null_terminated>::Encode(
     Array<std::uint8_t const> input,
@@ -54,17 +115,26 @@ void HexadecimalEncoder<null_terminated>::Encode(
         static_cast<void*>(&output.data[input.size << 1]) <= input.data)
       << "bad overlap";
   CHECK_GE(output.size, EncodedLength(input)) << "output too small";
-  // We want the result to start at |output.data[0]|.
-  output.data += ((input.size - 1) << 1);
   if constexpr (null_terminated) {
-    output.data[2] = 0;
+    output.data[input.size << 1] = 0;
+  }
+  // The bytes that don't fill a vector are at the end, so they are encoded
+  // first.  The same reasoning as above shows that encoding each vector
+  // backward is valid, since its input is read before its output is written.
+  std::int64_t i = input.size;
+  for (std::int64_t const vectorized_size = UseSSSE3() ? i & ~15 : 0;
+       i != vectorized_size;) {
+    --i;
+    std::memcpy(&output.data[i << 1],
+                &byte_to_hexadecimal_digits[input.data[i] << 1],
+                2);
   }
-  input.data += input.size - 1;
-  for (std::uint8_t const* const input_rend = input.data - input.size;
-       input.data != input_rend;
-       --input.data, output.data -= 2) {
-    std::memcpy(output.data, &byte_to_hexadecimal_digits[*input.data << 1], 2);
+#if PRINCIPIA_MAY_USE_SSSE3_INTRINSICS()
+  while (i != 0) {
+    i -= 16;
+    EncodeSSSE3(&input.data[i], &output.data[i << 1]);
   }
+#endif
 }
 
 template<bool null_terminated>
@@ -102,11 +172,23 @@ void HexadecimalEncoder<null_terminated>::Decode(Array<char const> input,
         &input.data[input.size] <= static_cast<void*>(output.data))
       << "bad overlap";
   CHECK_GE(output.size, input.size / 2) << "output too small";
-  for (char const* const input_end = input.data + input.size;
-       input.data != input_end;
-       input.data += 2, ++output.data) {
-    *output.data = (hexadecimal_digits_to_nibble[*input.data] << 4) |
-                   hexadecimal_digits_to_nibble[*(input.data + 1)];
+  char const* const input_end = input.data + input.size;
+#if PRINCIPIA_MAY_USE_SSSE3_INTRINSICS()
+  if (UseSSSE3()) {
+    for (char const* const input_vectorized_end =
+             input.data + (input.size & ~31);
+         input.data != input_vectorized_end;
+         input.data += 32, output.data += 16) {
+      DecodeSSSE3(input.data, output.data);
+    }
+  }
+#endif
+  for (; input.data != input_end; input.data += 2, ++output.data) {
+    *output.data =
+        (hexadecimal_digits_to_nibble[static_cast<std::uint8_t>(
+             *input.data)] << 4) |
+        hexadecimal_digits_to_nibble[static_cast<std::uint8_t>(
+            *(input.data + 1))];
   }
 }
 
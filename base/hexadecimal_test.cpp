@@ -1,7 +1,9 @@
 #include "base/hexadecimal.hpp"
 
 #include <cstdint>
+#include <cstdio>
 #include <memory>
+#include <random>
 #include <vector>
 
 #include "base/array.hpp"
@@ -168,5 +170,66 @@ TEST_F(HexadecimalTest, Invalid) {
   EXPECT_THAT(bytes, ElementsAre('\x0A', '\x0C', '\xDE'));
 }
 
+// Compares the (possibly vectorized) encoder with a straightforward scalar
+// implementation, on sizes that exercise both the vectors and the remainders,
+// in place and out of place.
+TEST_F(HexadecimalTest, Fuzz) {
+  auto const nibble = [](char const digit) -> std::uint8_t {
+    if (digit >= '0' && digit <= '9') {
+      return digit - '0';
+    } else if (digit >= 'A' && digit <= 'F') {
+      return digit - 'A' + 10;
+    } else if (digit >= 'a' && digit <= 'f') {
+      return digit - 'a' + 10;
+    } else {
+      return 0;
+    }
+  };
+  std::mt19937_64 random(42);
+  std::uniform_int_distribution<int> byte_distribution(0, 255);
+  std::uniform_int_distribution<int> digit_distribution(0, 21);
+  for (std::int64_t size = 1; size < 200; ++size) {
+    std::vector<std::uint8_t> bytes(size);
+    for (auto& byte : bytes) {
+      byte = byte_distribution(random);
+    }
+    std::vector<char> expected_digits(2 * size + 1);
+    for (std::int64_t i = 0; i < size; ++i) {
+      std::snprintf(&expected_digits[2 * i], 3, "%02X", bytes[i]);
+    }
+    expected_digits.pop_back();
+    std::vector<char> digits(2 * size);
+    encoder_.Encode(bytes, digits);
+    EXPECT_EQ(expected_digits, digits) << size;
+
+    // In place, with the input at an offset of 1.
+    std::vector<std::uint8_t> buffer(2 * size + 1);
+    std::copy(bytes.begin(), bytes.end(), buffer.begin() + 1);
+    encoder_.Encode({buffer.data() + 1, size},
+                    {reinterpret_cast<char*>(buffer.data()), 2 * size});
+    EXPECT_EQ(Array<char const>(expected_digits),
+              Array<std::uint8_t>(buffer.data(), 2 * size)) << size;
+
+    // Decoding of valid and invalid digits.
+    for (auto& digit : digits) {
+      digit = size % 2 == 0 ? "0123456789ABCDEFabcdef"[digit_distribution(
+                                  random)]
+                            : static_cast<char>(byte_distribution(random));
+    }
+    std::vector<std::uint8_t> expected_bytes(size);
+    for (std::int64_t i = 0; i < size; ++i) {
+      expected_bytes[i] = (nibble(digits[2 * i]) << 4) |
+                          nibble(digits[2 * i + 1]);
+    }
+    std::vector<std::uint8_t> decoded_bytes(size);
+    encoder_.Decode(digits, decoded_bytes);
+    EXPECT_EQ(expected_bytes, decoded_bytes) << size;
+    encoder_.Decode(digits, {reinterpret_cast<std::uint8_t*>(digits.data()),
+                             size});
+    EXPECT_EQ(Array<std::uint8_t const>(expected_bytes),
+              Array<char>(digits.data(), size)) << size;
+  }
+}
+
 }  // namespace base
 }  // namespace principia
@@ -116,6 +116,14 @@ char const* const Architecture = "x86-64";
 #define PRINCIPIA_USE_SSE3_INTRINSICS() !_DEBUG
 #define PRINCIPIA_USE_FMA_IF_AVAILABLE() !_DEBUG
 
+// SSSE3 is more recent than Prescott, so its use must be decided dynamically.
+// Clang and GCC can only emit SSSE3 instructions if the target has them.
+#if !_DEBUG && (PRINCIPIA_COMPILER_MSVC || defined(__SSSE3__))
+#  define PRINCIPIA_MAY_USE_SSSE3_INTRINSICS() 1
+#else
+#  define PRINCIPIA_MAY_USE_SSSE3_INTRINSICS() 0
+#endif
+
 // Set this to 1 to test analytical series based on piecewise Poisson series.
 #define PRINCIPIA_CONTINUOUS_TRAJECTORY_SUPPORTS_PIECEWISE_POISSON_SERIES 0
 
@@ -0,0 +1,205 @@
+#include "base/profiler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "absl/synchronization/mutex.h"
+
+namespace principia {
+namespace base {
+namespace _profiler {
+namespace internal {
+
+namespace {
+
+struct Event final {
+  char const* name;
+  Profiler::Clock::time_point begin;
+  Profiler::Clock::time_point end;
+};
+
+// The events recorded by a single thread.  The lock is only contended when the
+// events are exported.
+struct ThreadBuffer final {
+  explicit ThreadBuffer(int thread_id);
+
+  int const thread_id;
+  absl::Mutex lock;
+  // A ring buffer of capacity |Profiler::events_per_thread|.
+  std::vector<Event> events GUARDED_BY(lock);
+  // The total number of events appended to the buffer since the last
+  // |Clear|.
+  std::int64_t appended GUARDED_BY(lock) = 0;
+};
+
+ThreadBuffer::ThreadBuffer(int const thread_id) : thread_id(thread_id) {}
+
+struct Registry final {
+  absl::Mutex lock;
+  // The buffers are co-owned by their thread, so that they survive the threads
+  // that recorded them.
+  std::vector<std::shared_ptr<ThreadBuffer>> buffers GUARDED_BY(lock);
+};
+
+Registry& GetRegistry() {
+  static auto* const registry = new Registry;
+  return *registry;
+}
+
+Profiler::Clock::time_point Epoch() {
+  static Profiler::Clock::time_point const epoch = Profiler::Clock::now();
+  return epoch;
+}
+
+ThreadBuffer& ThisThreadBuffer() {
+  thread_local std::shared_ptr<ThreadBuffer> const buffer = []() {
+    Registry& registry = GetRegistry();
+    absl::MutexLock l(&registry.lock);
+    auto const buffer =
+        std::make_shared<ThreadBuffer>(registry.buffers.size());
+    registry.buffers.push_back(buffer);
+    return buffer;
+  }();
+  return *buffer;
+}
+
+void AppendToThisThreadBuffer(Event const& event) {
+  ThreadBuffer& buffer = ThisThreadBuffer();
+  absl::MutexLock l(&buffer.lock);
+  if (buffer.events.size() < Profiler::events_per_thread) {
+    buffer.events.push_back(event);
+  } else {
+    buffer.events[buffer.appended % Profiler::events_per_thread] = event;
+  }
+  ++buffer.appended;
+}
+
+// Calls |f| with the thread identifier and each of the events retained by that
+// thread, in chronological order for each thread.
+template<typename F>
+void ForAllEvents(F const& f) {
+  Registry& registry = GetRegistry();
+  absl::MutexLock l(&registry.lock);
+  for (auto const& buffer : registry.buffers) {
+    absl::MutexLock buffer_lock(&buffer->lock);
+    std::int64_t const size = buffer->events.size();
+    std::int64_t const first = buffer->appended - size;
+    for (std::int64_t i = first; i < buffer->appended; ++i) {
+      f(buffer->thread_id, buffer->events[i % Profiler::events_per_thread]);
+    }
+  }
+}
+
+// Returns the element of rank ⌈p n⌉ of the sorted |durations|.
+std::chrono::nanoseconds Percentile(
+    std::vector<std::chrono::nanoseconds> const& durations,
+    double const p) {
+  std::int64_t const rank = std::ceil(p * durations.size());
+  return durations[std::clamp<std::int64_t>(rank - 1, 0, durations.size() - 1)];
+}
+
+void WriteJSONString(std::ostream& out, char const* const s) {
+  out << '"';
+  for (char const* c = s; *c != '\0'; ++c) {
+    if (*c == '"' || *c == '\\') {
+      out << '\\' << *c;
+    } else if (static_cast<unsigned char>(*c) < 0x20) {
+      out << ' ';
+    } else {
+      out << *c;
+    }
+  }
+  out << '"';
+}
+
+}  // namespace
+
+std::atomic_bool Profiler::enabled_ = false;
+
+void Profiler::Enable(bool const enabled) {
+  // Make sure that the epoch precedes all the events.
+  Epoch();
+  enabled_.store(enabled, std::memory_order_relaxed);
+}
+
+void Profiler::Record(char const* const name,
+                      Clock::time_point const begin,
+                      Clock::time_point const end) {
+  if (enabled()) {
+    Append(name, begin, end);
+  }
+}
+
+void Profiler::Clear() {
+  Registry& registry = GetRegistry();
+  absl::MutexLock l(&registry.lock);
+  for (auto const& buffer : registry.buffers) {
+    absl::MutexLock buffer_lock(&buffer->lock);
+    buffer->events.clear();
+    buffer->appended = 0;
+  }
+}
+
+void Profiler::Append(char const* const name,
+                      Clock::time_point const begin,
+                      Clock::time_point const end) {
+  AppendToThisThreadBuffer({.name = name, .begin = begin, .end = end});
+}
+
+std::vector<Profiler::Statistics> Profiler::ComputeStatistics() {
+  std::map<std::string, std::vector<std::chrono::nanoseconds>> durations;
+  ForAllEvents([&durations](int const thread_id, Event const& event) {
+    durations[event.name].push_back(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(event.end -
+                                                             event.begin));
+  });
+  std::vector<Statistics> statistics;
+  for (auto& [name, name_durations] : durations) {
+    std::sort(name_durations.begin(), name_durations.end());
+    statistics.push_back({.name = name,
+                          .count = static_cast<std::int64_t>(
+                              name_durations.size()),
+                          .p50 = Percentile(name_durations, 0.5),
+                          .p99 = Percentile(name_durations, 0.99),
+                          .max = name_durations.back()});
+  }
+  return statistics;
+}
+
+void Profiler::WriteChromeTrace(std::ostream& out) {
+  using Microseconds = std::chrono::duration<double, std::micro>;
+  Clock::time_point const epoch = Epoch();
+  auto const flags = out.flags();
+  out << std::fixed << std::setprecision(3);
+  out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  bool first = true;
+  ForAllEvents([epoch, &first, &out](int const thread_id, Event const& event) {
+    if (!first) {
+      out << ",";
+    }
+    first = false;
+    out << "\n{\"name\":";
+    WriteJSONString(out, event.name);
+    out << ",\"cat\":\"principia\",\"ph\":\"X\",\"pid\":0,\"tid\":"
+        << thread_id
+        << ",\"ts\":" << Microseconds(event.begin - epoch).count()
+        << ",\"dur\":" << Microseconds(event.end - event.begin).count()
+        << "}";
+  });
+  out << "\n]}\n";
+  out.flags(flags);
+}
+
+}  // namespace internal
+}  // namespace _profiler
+}  // namespace base
+}  // namespace principia
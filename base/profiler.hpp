@@ -0,0 +1,97 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace principia {
+namespace base {
+namespace _profiler {
+namespace internal {
+
+// A low-overhead profiler for finding stutters in production.  When enabled,
+// each thread records the scopes that it executes in a ring buffer of its own;
+// the buffers may be exported as a trace in the Chrome trace event format,
+// which can be loaded in chrome://tracing or Perfetto, and summarized as
+// latency statistics per scope name.  When disabled, the cost of a scope is
+// that of a relaxed atomic load.
+//
+// Example of usage:
+//   void Plugin::CatchUpLaggingVessels(...) {
+//     Profiler::Scope const scope("Plugin::CatchUpLaggingVessels");
+//     ...
+//   }
+class Profiler {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  // The number of events retained by each thread.  Older events are
+  // overwritten.
+  static constexpr int events_per_thread = 1 << 13;
+
+  // Measures the time spent between its construction and its destruction.
+  // Scopes may be nested.  The |name| must outlive the profiler, e.g., it must
+  // be a string literal.
+  class Scope final {
+   public:
+    explicit Scope(char const* name);
+    ~Scope();
+
+    Scope(Scope const&) = delete;
+    Scope& operator=(Scope const&) = delete;
+
+   private:
+    // Null if the profiler was disabled at construction.
+    char const* const name_;
+    Clock::time_point begin_;
+  };
+
+  struct Statistics final {
+    std::string name;
+    std::int64_t count;
+    std::chrono::nanoseconds p50;
+    std::chrono::nanoseconds p99;
+    std::chrono::nanoseconds max;
+  };
+
+  static void Enable(bool enabled);
+  static bool enabled();
+
+  // Records an event that does not correspond to a lexical scope.  The |name|
+  // must outlive the profiler.  No-op if the profiler is disabled.
+  static void Record(char const* name,
+                     Clock::time_point begin,
+                     Clock::time_point end);
+
+  // Discards all the recorded events.
+  static void Clear();
+
+  // Returns the latency statistics of the retained events, by increasing name.
+  static std::vector<Statistics> ComputeStatistics();
+
+  // Writes the retained events as a JSON object in the Chrome trace event
+  // format.
+  static void WriteChromeTrace(std::ostream& out);
+
+ private:
+  // Appends an event to the buffer of the current thread, irrespective of
+  // whether the profiler is enabled.
+  static void Append(char const* name,
+                     Clock::time_point begin,
+                     Clock::time_point end);
+
+  static std::atomic_bool enabled_;
+};
+
+}  // namespace internal
+
+using internal::Profiler;
+
+}  // namespace _profiler
+}  // namespace base
+}  // namespace principia
+
+#include "base/profiler_body.hpp"
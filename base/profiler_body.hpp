@@ -0,0 +1,30 @@
+#pragma once
+
+#include "base/profiler.hpp"
+
+namespace principia {
+namespace base {
+namespace _profiler {
+namespace internal {
+
+inline Profiler::Scope::Scope(char const* const name)
+    : name_(enabled() ? name : nullptr) {
+  if (name_ != nullptr) {
+    begin_ = Clock::now();
+  }
+}
+
+inline Profiler::Scope::~Scope() {
+  if (name_ != nullptr) {
+    Append(name_, begin_, Clock::now());
+  }
+}
+
+inline bool Profiler::enabled() {
+  return enabled_.load(std::memory_order_relaxed);
+}
+
+}  // namespace internal
+}  // namespace _profiler
+}  // namespace base
+}  // namespace principia
@@ -0,0 +1,103 @@
+#include "base/profiler.hpp"
+
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace principia {
+namespace base {
+
+using ::testing::AllOf;
+using ::testing::ElementsAre;
+using ::testing::Field;
+using ::testing::Ge;
+using ::testing::HasSubstr;
+using ::testing::IsEmpty;
+using namespace principia::base::_profiler;
+using namespace std::chrono_literals;
+
+class ProfilerTest : public ::testing::Test {
+ protected:
+  ProfilerTest() {
+    Profiler::Clear();
+    Profiler::Enable(true);
+  }
+
+  ~ProfilerTest() override {
+    Profiler::Enable(false);
+    Profiler::Clear();
+  }
+};
+
+TEST_F(ProfilerTest, Disabled) {
+  Profiler::Enable(false);
+  {
+    Profiler::Scope const scope("Disabled");
+  }
+  Profiler::Record("Disabled",
+                   Profiler::Clock::now(),
+                   Profiler::Clock::now());
+  EXPECT_THAT(Profiler::ComputeStatistics(), IsEmpty());
+}
+
+TEST_F(ProfilerTest, NestedScopes) {
+  for (int i = 0; i < 3; ++i) {
+    Profiler::Scope const outer("Outer");
+    for (int j = 0; j < 2; ++j) {
+      Profiler::Scope const inner("Inner");
+      std::this_thread::sleep_for(1ms);
+    }
+  }
+  auto const statistics = Profiler::ComputeStatistics();
+  EXPECT_THAT(
+      statistics,
+      ElementsAre(AllOf(Field(&Profiler::Statistics::name, "Inner"),
+                        Field(&Profiler::Statistics::count, 6),
+                        Field(&Profiler::Statistics::p50, Ge(1ms))),
+                  AllOf(Field(&Profiler::Statistics::name, "Outer"),
+                        Field(&Profiler::Statistics::count, 3),
+                        Field(&Profiler::Statistics::p50, Ge(2ms)))));
+  EXPECT_LE(statistics[0].p50, statistics[0].p99);
+  EXPECT_LE(statistics[0].p99, statistics[0].max);
+
+  std::stringstream trace;
+  Profiler::WriteChromeTrace(trace);
+  EXPECT_THAT(trace.str(),
+              AllOf(HasSubstr(R"("traceEvents":[)"),
+                    HasSubstr(R"({"name":"Outer","cat":"principia")"),
+                    HasSubstr(R"({"name":"Inner","cat":"principia")")));
+}
+
+TEST_F(ProfilerTest, RingBuffer) {
+  for (int i = 0; i < Profiler::events_per_thread + 10; ++i) {
+    Profiler::Scope const scope("Ring");
+  }
+  EXPECT_THAT(Profiler::ComputeStatistics(),
+              ElementsAre(Field(&Profiler::Statistics::count,
+                                Profiler::events_per_thread)));
+}
+
+TEST_F(ProfilerTest, Threads) {
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([]() {
+      for (int j = 0; j < 100; ++j) {
+        Profiler::Scope const scope("Thread");
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  // The events survive their threads.
+  EXPECT_THAT(Profiler::ComputeStatistics(),
+              ElementsAre(Field(&Profiler::Statistics::count, 400)));
+}
+
+}  // namespace base
+}  // namespace principia
@@ -1,15 +1,18 @@
 #pragma once
 
 #include <cstdint>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <queue>
 #include <thread>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/synchronization/mutex.h"
 #include "base/array.hpp"
 #include "base/not_null.hpp"
+#include "base/thread_pool.hpp"
 #include "gipfeli/compression.h"
 #include "google/protobuf/io/zero_copy_stream.h"
 #include "google/protobuf/message.h"
@@ -21,6 +24,7 @@ namespace internal {
 
 using namespace principia::base::_array;
 using namespace principia::base::_not_null;
+using namespace principia::base::_thread_pool;
 
 using ::google::compression::Compressor;
 
@@ -71,6 +75,17 @@ class PullSerializer final {
   PullSerializer(int chunk_size,
                  int number_of_chunks,
                  std::unique_ptr<Compressor> compressor);
+  // Same as above, but the chunks are compressed in parallel with the
+  // serialization and with each other, by |number_of_compressors| compressors
+  // returned by |compressor_factory|, each used by at most one thread at a
+  // time.  No compression takes place if |compressor_factory| returns null.
+  // Each chunk being compressed uses two chunks of memory, so
+  // |number_of_chunks| limits the parallelism.
+  PullSerializer(
+      int chunk_size,
+      int number_of_chunks,
+      std::function<std::unique_ptr<Compressor>()> const& compressor_factory,
+      int number_of_compressors);
   ~PullSerializer();
 
   // Starts the serializer, which will proceed to serialize |message|.  This
@@ -87,21 +102,41 @@ class PullSerializer final {
   // stream and the boundaries between chunks are irrelevant.  In the presence
   // of compression however, the data producted by |Pull| are made of blocks and
   // the boundaries between chunks are relevant and must be preserved by the
-  // clients and used when feeding data back to the deserializer.
+  // clients and used when feeding data back to the deserializer.  Each block is
+  // compressed independently of the others, so the deserializer may decompress
+  // them in parallel.
   Array<std::uint8_t> Pull();
 
  private:
+  // A chunk enqueued for |Pull|.  It is not |ready| while its data is being
+  // compressed.
+  struct Chunk {
+    Array<std::uint8_t> bytes;
+    bool ready;
+  };
+
+  static std::vector<not_null<std::unique_ptr<Compressor>>> MakeCompressors(
+      std::function<std::unique_ptr<Compressor>()> const& compressor_factory,
+      int number_of_compressors);
+
   // Enqueues the chunk of data to be returned to |Pull| and returns a free
   // chunk.  Blocks if there are no free chunks.  Used as a callback for the
   // underlying |DelegatingArrayOutputStream|.
   Array<std::uint8_t> Push(Array<std::uint8_t> bytes);
 
+  // Compresses |bytes| into |compressed_data| and marks |chunk| as ready.  Runs
+  // on the |compression_pool_|.
+  void Compress(Array<std::uint8_t> bytes,
+                not_null<std::uint8_t*> compressed_data,
+                Chunk& chunk);
+
   // |owned_message_| is null if this object doesn't own the message.
   // |message_| is non-null after Start.
   std::unique_ptr<google::protobuf::Message const> owned_message_;
   google::protobuf::Message const* message_ = nullptr;
 
-  std::unique_ptr<Compressor> const compressor_;
+  // Empty in the absence of compression.
+  std::vector<not_null<std::unique_ptr<Compressor>>> const compressors_;
 
   // The chunk size passed at construction.  The stream outputs chunks of that
   // size.
@@ -115,10 +150,6 @@ class PullSerializer final {
   // The number of chunks passed at construction, used to size |data_|.
   int const number_of_chunks_;
 
-  // How many of the |number_of_chunks_| chunks in |data_| are reserved for
-  // compression.
-  int const number_of_compression_chunks_;
-
   // The array supporting the stream and the stream itself.
   std::unique_ptr<std::uint8_t[]> data_;
   DelegatingArrayOutputStream stream_;
@@ -128,17 +159,28 @@ class PullSerializer final {
 
   absl::Mutex lock_;
 
-  // The |queue_| contains the |Array<std::uint8_t>| objects filled by |Push|
-  // and not yet consumed by |Pull|.  If a |Array<std::uint8_t>| object has been
-  // handed over to the caller by |Pull| it stays in the queue until the next
-  // call to |Pull|, to make sure that the pointer is not reused while the
-  // caller processes it.
-  std::queue<Array<std::uint8_t>> queue_ GUARDED_BY(lock_);
+  // The |queue_| contains the chunks filled by |Push| and not yet consumed by
+  // |Pull|, in order.  If a chunk has been handed over to the caller by |Pull|
+  // it stays in the queue until the next call to |Pull|, to make sure that the
+  // pointer is not reused while the caller processes it.  This is a deque
+  // because the compression threads hold references to its elements.
+  std::deque<Chunk> queue_ GUARDED_BY(lock_);
 
   // The |free_| queue contains the start addresses of chunks that are not yet
   // ready to be returned by |Pull|.  That includes the chunk currently being
-  // filled by the stream.
+  // filled by the stream, which is at the front.
   std::queue<not_null<std::uint8_t*>> free_ GUARDED_BY(lock_);
+
+  // The number of chunks whose data is being compressed.  Their compressed
+  // data is in a chunk of |queue_|.
+  std::int64_t chunks_being_compressed_ GUARDED_BY(lock_) = 0;
+
+  // The |compressors_| that are not being used by a compression thread.
+  std::vector<not_null<Compressor*>> idle_compressors_ GUARDED_BY(lock_);
+
+  // Null in the absence of compression.  Destroyed first, as the compression
+  // threads use the other members.
+  std::unique_ptr<ThreadPool<void>> const compression_pool_;
 };
 
 }  // namespace internal
@@ -68,20 +68,40 @@ inline std::int64_t DelegatingArrayOutputStream::ByteCount() const {
 inline PullSerializer::PullSerializer(int const chunk_size,
                                       int const number_of_chunks,
                                       std::unique_ptr<Compressor> compressor)
-    : compressor_(std::move(compressor)),
+    : PullSerializer(chunk_size,
+                     number_of_chunks,
+                     /*compressor_factory=*/[&compressor]() {
+                       return std::move(compressor);
+                     },
+                     /*number_of_compressors=*/1) {}
+
+inline PullSerializer::PullSerializer(
+    int const chunk_size,
+    int const number_of_chunks,
+    std::function<std::unique_ptr<Compressor>()> const& compressor_factory,
+    int const number_of_compressors)
+    : compressors_(MakeCompressors(compressor_factory, number_of_compressors)),
       chunk_size_(chunk_size),
       compressed_chunk_size_(
-          compressor_ == nullptr
+          compressors_.empty()
               ? chunk_size_
-              : compressor_->MaxCompressedLength(chunk_size_)),
+              : compressors_.front()->MaxCompressedLength(chunk_size_)),
       number_of_chunks_(number_of_chunks),
-      number_of_compression_chunks_(compressor_ == nullptr ? 0 : 1),
       data_(std::make_unique<std::uint8_t[]>(compressed_chunk_size_ *
                                              number_of_chunks_)),
       stream_(Array<std::uint8_t>(data_.get(), chunk_size_),
-              std::bind(&PullSerializer::Push, this, _1)) {
-  // Check the compatibility of the wait conditions in Push and Pull.
-  CHECK_GT(number_of_chunks_ - number_of_compression_chunks_ - 1, 1);
+              std::bind(&PullSerializer::Push, this, _1)),
+      compression_pool_(compressors_.empty()
+                            ? nullptr
+                            : std::make_unique<ThreadPool<void>>(
+                                  compressors_.size())) {
+  // Check the compatibility of the wait conditions in Push and Pull: besides
+  // the sentinel of the |queue_|, |Push| needs the chunk being filled, the
+  // next one, and one for the compressed data, if any.
+  CHECK_GE(number_of_chunks_, compressors_.empty() ? 3 : 4);
+  for (auto const& compressor : compressors_) {
+    idle_compressors_.push_back(compressor.get());
+  }
 
   // Mark all the chunks as free except the last one which is a sentinel for the
   // |queue_|.  The 0th chunk has been passed to the stream, but it's still free
@@ -91,8 +111,10 @@ inline PullSerializer::PullSerializer(int const chunk_size,
   for (int i = 0; i < number_of_chunks_ - 1; ++i) {
     free_.push(data_.get() + i * compressed_chunk_size_);
   }
-  queue_.push(Array<std::uint8_t>(
-      data_.get() + (number_of_chunks_ - 1) * compressed_chunk_size_, 0));
+  queue_.push_back(
+      {.bytes = Array<std::uint8_t>(
+           data_.get() + (number_of_chunks_ - 1) * compressed_chunk_size_, 0),
+       .ready = true});
 }
 
 inline PullSerializer::~PullSerializer() {
@@ -131,62 +153,96 @@ inline Array<std::uint8_t> PullSerializer::Pull() {
     absl::MutexLock l(&lock_);
 
     // The element at the front of the queue is the one that was last returned
-    // by |Pull| and must be dropped and freed.
-    auto const queue_has_elements = [this]() { return queue_.size() > 1; };
-    lock_.Await(absl::Condition(&queue_has_elements));
-
-    CHECK_LE(2, queue_.size());
-    free_.push(queue_.front().data);
-    queue_.pop();
-    result = queue_.front();
-    CHECK_EQ(number_of_chunks_, queue_.size() + free_.size());
+    // by |Pull| and must be dropped and freed.  The chunks become ready out of
+    // order, but they are returned in order.
+    auto const next_chunk_is_ready = [this]() {
+      return queue_.size() > 1 && queue_[1].ready;
+    };
+    lock_.Await(absl::Condition(&next_chunk_is_ready));
+
+    free_.push(queue_.front().bytes.data);
+    queue_.pop_front();
+    result = queue_.front().bytes;
+    CHECK_EQ(number_of_chunks_,
+             queue_.size() + free_.size() + chunks_being_compressed_);
   }
   return result;
 }
 
+inline std::vector<not_null<std::unique_ptr<Compressor>>>
+PullSerializer::MakeCompressors(
+    std::function<std::unique_ptr<Compressor>()> const& compressor_factory,
+    int const number_of_compressors) {
+  std::vector<not_null<std::unique_ptr<Compressor>>> compressors;
+  for (int i = 0; i < number_of_compressors; ++i) {
+    std::unique_ptr<Compressor> compressor = compressor_factory();
+    if (compressor == nullptr) {
+      break;
+    }
+    compressors.push_back(std::move(compressor));
+  }
+  return compressors;
+}
+
 inline Array<std::uint8_t> PullSerializer::Push(Array<std::uint8_t> bytes) {
-  Array<std::uint8_t> result;
   CHECK_GE(chunk_size_, bytes.size);
-  if (bytes.size > 0 && compressor_ != nullptr) {
-    Array<std::uint8_t> compressed_bytes;
-    {
-      absl::MutexLock l(&lock_);
-      CHECK_LE(1 + number_of_compression_chunks_, free_.size());
-      free_.pop();
-      compressed_bytes =
-          Array<std::uint8_t>(free_.front(), compressed_chunk_size_);
-      free_.push(bytes.data);
-    }
-    // We maintain the invariant that the chunk being filled is at the front of
-    // the |free_| queue.
-    ArraySource<std::uint8_t> source(bytes);
-    ArraySink<std::uint8_t> sink(compressed_bytes);
-    compressor_->CompressStream(&source, &sink);
-    {
-      absl::MutexLock l(&lock_);
-      bytes = sink.array();
-    }
+  bool const compress = bytes.size > 0 && compression_pool_ != nullptr;
+  absl::MutexLock l(&lock_);
+
+  // We maintain the invariant that the chunk being filled is at the front of
+  // the |free_| queue.  We need another free chunk to fill next, and one for
+  // the compressed data, if any.  Free chunks are returned by |Pull| and by
+  // the compression threads.
+  std::size_t const needed_free_chunks = compress ? 3 : 2;
+  auto const enough_free_chunks = [this, needed_free_chunks]() {
+    return free_.size() >= needed_free_chunks;
+  };
+  lock_.Await(absl::Condition(&enough_free_chunks));
+
+  CHECK_EQ(free_.front(), bytes.data);
+  free_.pop();
+  if (compress) {
+    not_null<std::uint8_t*> const compressed_data = free_.front();
+    free_.pop();
+    Chunk& chunk = queue_.emplace_back(
+        Chunk{.bytes = Array<std::uint8_t>(compressed_data, 0),
+              .ready = false});
+    ++chunks_being_compressed_;
+    compression_pool_->Add([this, bytes, compressed_data, &chunk]() {
+      Compress(bytes, compressed_data, chunk);
+    });
+  } else {
+    queue_.push_back({.bytes = bytes, .ready = true});
   }
+  CHECK_EQ(number_of_chunks_,
+           queue_.size() + free_.size() + chunks_being_compressed_);
+  return Array<std::uint8_t>(free_.front(), chunk_size_);
+}
+
+inline void PullSerializer::Compress(
+    Array<std::uint8_t> const bytes,
+    not_null<std::uint8_t*> const compressed_data,
+    Chunk& chunk) {
+  Compressor* compressor;
   {
     absl::MutexLock l(&lock_);
-
-    auto const queue_has_room = [this]() {
-      // -1 here is because we want to ensure that there is an entry in the
-      // free list, in addition to |result| and to
-      // |number_of_compression_chunks_| (if present).
-      return queue_.size() < static_cast<std::size_t>(number_of_chunks_) -
-                                 number_of_compression_chunks_ - 1;
-    };
-    lock_.Await(absl::Condition(&queue_has_room));
-
-    queue_.emplace(bytes.data, bytes.size);
-    CHECK_LE(2 + number_of_compression_chunks_, free_.size());
-    CHECK_EQ(free_.front(), bytes.data);
-    free_.pop();
-    result = Array<std::uint8_t>(free_.front(), chunk_size_);
-    CHECK_EQ(number_of_chunks_, queue_.size() + free_.size());
+    // There are as many compressors as compression threads.
+    CHECK(!idle_compressors_.empty());
+    compressor = idle_compressors_.back();
+    idle_compressors_.pop_back();
+  }
+  ArraySource<std::uint8_t> source(bytes);
+  ArraySink<std::uint8_t> sink(
+      Array<std::uint8_t>(compressed_data, compressed_chunk_size_));
+  compressor->CompressStream(&source, &sink);
+  {
+    absl::MutexLock l(&lock_);
+    idle_compressors_.push_back(compressor);
+    chunk.bytes = sink.array();
+    chunk.ready = true;
+    free_.push(bytes.data);
+    --chunks_being_compressed_;
   }
-  return result;
 }
 
 }  // namespace internal
@@ -178,6 +178,53 @@ TEST_F(PullSerializerTest, SerializationGipfeli) {
   EXPECT_EQ(uncompressed1, uncompressed2);
 }
 
+TEST_F(PullSerializerTest, SerializationGipfeliParallel) {
+  std::string uncompressed1;
+  std::string uncompressed2;
+  {
+    auto trajectory = BuildTrajectory();
+    pull_serializer_->Start(std::move(trajectory));
+    for (;;) {
+      Array<std::uint8_t> const bytes = pull_serializer_->Pull();
+      if (bytes.size == 0) {
+        break;
+      }
+      for (int i = 0; i < bytes.size; ++i) {
+        uncompressed1.append(1, bytes.data[i]);
+      }
+    }
+  }
+  {
+    auto const compressed_pull_serializer = std::make_unique<PullSerializer>(
+        chunk_size,
+        /*number_of_chunks=*/8,
+        /*compressor_factory=*/[]() {
+          return std::unique_ptr<Compressor>(
+              google::compression::NewGipfeliCompressor());
+        },
+        /*number_of_compressors=*/3);
+    auto trajectory = BuildTrajectory();
+    compressed_pull_serializer->Start(std::move(trajectory));
+    auto compressor = google::compression::NewGipfeliCompressor();
+    for (;;) {
+      Array<std::uint8_t> const bytes = compressed_pull_serializer->Pull();
+      if (bytes.size == 0) {
+        break;
+      }
+      // Each chunk is compressed independently of the others.
+      std::string compressed;
+      std::string uncompressed;
+      for (int i = 0; i < bytes.size; ++i) {
+        compressed.append(1, bytes.data[i]);
+      }
+      CHECK(compressor->Uncompress(compressed, &uncompressed));
+      uncompressed2.append(uncompressed);
+    }
+  }
+
+  EXPECT_EQ(uncompressed1, uncompressed2);
+}
+
 TEST_F(PullSerializerTest, SerializationThreading) {
   DiscreteTrajectory read_trajectory;
   auto const trajectory = BuildTrajectory();
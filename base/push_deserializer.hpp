@@ -1,16 +1,19 @@
 #pragma once
 
 #include <cstdint>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <ostream>
 #include <queue>
 #include <thread>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/synchronization/mutex.h"
 #include "base/array.hpp"
 #include "base/not_null.hpp"
+#include "base/thread_pool.hpp"
 #include "gipfeli/compression.h"
 #include "google/protobuf/io/zero_copy_stream.h"
 #include "google/protobuf/message.h"
@@ -22,6 +25,7 @@ namespace internal {
 
 using namespace principia::base::_array;
 using namespace principia::base::_not_null;
+using namespace principia::base::_thread_pool;
 
 using ::google::compression::Compressor;
 
@@ -69,10 +73,21 @@ class PushDeserializer final {
   // The |size| of the data chunks sent to |Pull| are never greater than
   // |chunk_size|.  The internal queue holds at most |number_of_chunks| chunks.
   // Therefore, this class uses at most
-  // |number_of_chunks * (chunk_size + O(1)) + O(1)| bytes.
+  // |number_of_chunks * (chunk_size + O(1)) + O(1)| bytes, plus
+  // |chunk_size| bytes for each chunk being decompressed if there is
+  // compression.
   PushDeserializer(int chunk_size,
                    int number_of_chunks,
                    std::unique_ptr<Compressor> compressor);
+  // Same as above, but the chunks are decompressed in parallel with the
+  // deserialization and with each other, by |number_of_compressors| compressors
+  // returned by |compressor_factory|, each used by at most one thread at a
+  // time.  No decompression takes place if |compressor_factory| returns null.
+  PushDeserializer(
+      int chunk_size,
+      int number_of_chunks,
+      std::function<std::unique_ptr<Compressor>()> const& compressor_factory,
+      int number_of_compressors);
   ~PushDeserializer();
 
   // Starts the deserializer, which will proceed to deserialize data into
@@ -98,17 +113,33 @@ class PushDeserializer final {
   void Push(UniqueArray<std::uint8_t> bytes);
 
  private:
+  // A chunk pushed by the client.  It is not |ready| while its data is being
+  // decompressed; once it is ready, |bytes| designates the decompressed data.
+  struct Chunk {
+    Array<std::uint8_t> bytes;
+    bool ready;
+  };
+
+  static std::vector<not_null<std::unique_ptr<Compressor>>> MakeCompressors(
+      std::function<std::unique_ptr<Compressor>()> const& compressor_factory,
+      int number_of_compressors);
+
   // Obtains the next chunk of data from the internal queue.  Blocks if no data
   // is available.  Used as a callback for the underlying
   // |DelegatingArrayOutputStream|.
   Array<std::uint8_t> Pull();
 
+  // Decompresses the data of |chunk| into |uncompressed_data| and marks |chunk|
+  // as ready.  Runs on the |decompression_pool_|.
+  void Uncompress(not_null<std::uint8_t*> uncompressed_data, Chunk& chunk);
+
   // |owned_message_| is null if this object doesn't own the message.
   // |message_| is non-null after Start.
   std::unique_ptr<google::protobuf::Message> owned_message_;
   google::protobuf::Message* message_ = nullptr;
 
-  std::unique_ptr<Compressor> const compressor_;
+  // Empty in the absence of compression.
+  std::vector<not_null<std::unique_ptr<Compressor>>> const compressors_;
 
   // The chunk size passed at construction.  The stream consumes chunks of that
   // size.
@@ -122,6 +153,9 @@ class PushDeserializer final {
   // The number of chunks passed at construction, used to size |data_|.
   int const number_of_chunks_;
 
+  // In the presence of compression, room for |number_of_chunks_ + 1|
+  // decompressed chunks: those in |queue_| and the one being read by the
+  // stream.
   UniqueArray<std::uint8_t> uncompressed_data_;
 
   DelegatingArrayInputStream stream_;
@@ -129,13 +163,27 @@ class PushDeserializer final {
 
   absl::Mutex lock_;
 
-  // The |queue_| contains the |Array<std::uint8_t>| object filled by |Push| and
-  // not yet consumed by |Pull|.  The |done_| queue contains the callbacks.  The
-  // two queues are out of step: an element is removed from |queue_| by |Pull|
-  // when it returns a chunk to the stream, but the corresponding callback is
-  // removed from |done_| (and executed) when |Pull| returns.
-  std::queue<Array<std::uint8_t>> queue_ GUARDED_BY(lock_);
+  // The |queue_| contains the chunks filled by |Push| and not yet consumed by
+  // |Pull|, in order.  The |done_| queue contains the callbacks.  The two
+  // queues are out of step: an element is removed from |queue_| by |Pull| when
+  // it returns a chunk to the stream, but the corresponding callback is removed
+  // from |done_| (and executed) when |Pull| returns.  This is a deque because
+  // the decompression threads hold references to its elements.
+  std::deque<Chunk> queue_ GUARDED_BY(lock_);
   std::queue<std::function<void()>> done_ GUARDED_BY(lock_);
+
+  // The chunks of |uncompressed_data_| that are neither in |queue_| nor being
+  // read by the stream.
+  std::vector<not_null<std::uint8_t*>> free_uncompressed_ GUARDED_BY(lock_);
+  // The chunk of |uncompressed_data_| being read by the stream, if any.
+  std::uint8_t* uncompressed_in_stream_ GUARDED_BY(lock_) = nullptr;
+
+  // The |compressors_| that are not being used by a decompression thread.
+  std::vector<not_null<Compressor*>> idle_compressors_ GUARDED_BY(lock_);
+
+  // Null in the absence of compression.  Destroyed first, as the
+  // decompression threads use the other members.
+  std::unique_ptr<ThreadPool<void>> const decompression_pool_;
 };
 
 }  // namespace internal
@@ -110,17 +110,42 @@ inline PushDeserializer::PushDeserializer(
     int const chunk_size,
     int const number_of_chunks,
     std::unique_ptr<Compressor> compressor)
-    : compressor_(std::move(compressor)),
+    : PushDeserializer(chunk_size,
+                       number_of_chunks,
+                       /*compressor_factory=*/[&compressor]() {
+                         return std::move(compressor);
+                       },
+                       /*number_of_compressors=*/1) {}
+
+inline PushDeserializer::PushDeserializer(
+    int const chunk_size,
+    int const number_of_chunks,
+    std::function<std::unique_ptr<Compressor>()> const& compressor_factory,
+    int const number_of_compressors)
+    : compressors_(MakeCompressors(compressor_factory, number_of_compressors)),
       chunk_size_(chunk_size),
       compressed_chunk_size_(
-          compressor_ == nullptr
+          compressors_.empty()
               ? chunk_size_
-              : compressor_->MaxCompressedLength(chunk_size_)),
+              : compressors_.front()->MaxCompressedLength(chunk_size_)),
       number_of_chunks_(number_of_chunks),
-      uncompressed_data_(chunk_size_),
-      stream_(std::bind(&PushDeserializer::Pull, this)) {
+      uncompressed_data_(
+          compressors_.empty() ? 0 : (number_of_chunks_ + 1) * chunk_size_),
+      stream_(std::bind(&PushDeserializer::Pull, this)),
+      decompression_pool_(compressors_.empty()
+                              ? nullptr
+                              : std::make_unique<ThreadPool<void>>(
+                                    compressors_.size())) {
   // This sentinel ensures that the two queues are correctly out of step.
   done_.push(nullptr);
+  if (!compressors_.empty()) {
+    for (int i = 0; i <= number_of_chunks_; ++i) {
+      free_uncompressed_.push_back(&uncompressed_data_.data[i * chunk_size_]);
+    }
+  }
+  for (auto const& compressor : compressors_) {
+    idle_compressors_.push_back(compressor.get());
+  }
 }
 
 inline PushDeserializer::~PushDeserializer() {
@@ -180,7 +205,7 @@ inline void PushDeserializer::Push(Array<std::uint8_t> const bytes,
   // absence of compression we have a stream so we can cut into as many chunks
   // as we like.
   int queued_chunk_size;
-  if (compressor_ == nullptr) {
+  if (compressors_.empty()) {
     queued_chunk_size = chunk_size_;
   } else {
     CHECK_LE(bytes.size, compressed_chunk_size_);
@@ -198,9 +223,25 @@ inline void PushDeserializer::Push(Array<std::uint8_t> const bytes,
       };
       lock_.Await(absl::Condition(&queue_has_room));
 
-      queue_.emplace(current.data,
-                     std::min(current.size,
-                              static_cast<std::int64_t>(queued_chunk_size)));
+      Array<std::uint8_t> const queued_bytes(
+          current.data,
+          std::min(current.size, static_cast<std::int64_t>(queued_chunk_size)));
+      if (queued_bytes.size == 0 || decompression_pool_ == nullptr) {
+        queue_.push_back({.bytes = queued_bytes, .ready = true});
+      } else {
+        // There is always a free chunk here because at most
+        // |number_of_chunks_ - 1| chunks are in |queue_| and one is being read
+        // by the stream.
+        CHECK(!free_uncompressed_.empty());
+        not_null<std::uint8_t*> const uncompressed_data =
+            free_uncompressed_.back();
+        free_uncompressed_.pop_back();
+        Chunk& chunk = queue_.emplace_back(
+            Chunk{.bytes = queued_bytes, .ready = false});
+        decompression_pool_->Add([this, uncompressed_data, &chunk]() {
+          Uncompress(uncompressed_data, chunk);
+        });
+      }
       done_.emplace(is_last ? std::move(done) : nullptr);
     }
     current.data = &current.data[queued_chunk_size];
@@ -220,8 +261,11 @@ inline Array<std::uint8_t> PushDeserializer::Pull() {
   {
     absl::MutexLock l(&lock_);
 
-    auto const queue_has_elements =  [this]() { return !queue_.empty(); };
-    lock_.Await(absl::Condition(&queue_has_elements));
+    // The chunks become ready out of order, but they are returned in order.
+    auto const front_chunk_is_ready = [this]() {
+      return !queue_.empty() && queue_.front().ready;
+    };
+    lock_.Await(absl::Condition(&front_chunk_is_ready));
 
     // The front of |done_| is the callback for the |Array<std::uint8_t>| object
     // that was just processed.  Run it now.
@@ -231,22 +275,62 @@ inline Array<std::uint8_t> PushDeserializer::Pull() {
       done();
     }
     done_.pop();
+    // The stream is done with the decompressed chunk that it was reading.
+    if (uncompressed_in_stream_ != nullptr) {
+      free_uncompressed_.push_back(uncompressed_in_stream_);
+      uncompressed_in_stream_ = nullptr;
+    }
     // Get the next |Array<std::uint8_t>| object to process and remove it from
-    // |queue_|.  Uncompress it if needed.
-    auto const& front = queue_.front();
-    if (front.size == 0 || compressor_ == nullptr) {
-      result = front;
-    } else {
-      ArraySource<std::uint8_t> source(front);
-      ArraySink<std::uint8_t> sink(uncompressed_data_.get());
-      CHECK(compressor_->UncompressStream(&source, &sink));
-      result = sink.array();
+    // |queue_|.  It has already been decompressed if needed.
+    result = queue_.front().bytes;
+    if (result.size > 0 && decompression_pool_ != nullptr) {
+      uncompressed_in_stream_ = result.data;
     }
-    queue_.pop();
+    queue_.pop_front();
   }
   return result;
 }
 
+inline std::vector<not_null<std::unique_ptr<Compressor>>>
+PushDeserializer::MakeCompressors(
+    std::function<std::unique_ptr<Compressor>()> const& compressor_factory,
+    int const number_of_compressors) {
+  std::vector<not_null<std::unique_ptr<Compressor>>> compressors;
+  for (int i = 0; i < number_of_compressors; ++i) {
+    std::unique_ptr<Compressor> compressor = compressor_factory();
+    if (compressor == nullptr) {
+      break;
+    }
+    compressors.push_back(std::move(compressor));
+  }
+  return compressors;
+}
+
+inline void PushDeserializer::Uncompress(
+    not_null<std::uint8_t*> const uncompressed_data,
+    Chunk& chunk) {
+  Compressor* compressor;
+  Array<std::uint8_t> compressed_bytes;
+  {
+    absl::MutexLock l(&lock_);
+    // There are as many compressors as decompression threads.
+    CHECK(!idle_compressors_.empty());
+    compressor = idle_compressors_.back();
+    idle_compressors_.pop_back();
+    compressed_bytes = chunk.bytes;
+  }
+  ArraySource<std::uint8_t> source(compressed_bytes);
+  ArraySink<std::uint8_t> sink(
+      Array<std::uint8_t>(uncompressed_data, chunk_size_));
+  CHECK(compressor->UncompressStream(&source, &sink));
+  {
+    absl::MutexLock l(&lock_);
+    idle_compressors_.push_back(compressor);
+    chunk.bytes = sink.array();
+    chunk.ready = true;
+  }
+}
+
 }  // namespace internal
 }  // namespace _push_deserializer
 }  // namespace base
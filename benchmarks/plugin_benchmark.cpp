@@ -0,0 +1,394 @@
+// .\Release\x64\benchmarks.exe --benchmark_repetitions=3 --benchmark_filter=PluginFrame  // NOLINT(whitespace/line_length)
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "astronomy/frames.hpp"
+#include "base/not_null.hpp"
+#include "base/profiler.hpp"
+#include "benchmark/benchmark.h"
+#include "geometry/grassmann.hpp"
+#include "geometry/instant.hpp"
+#include "geometry/orthogonal_map.hpp"
+#include "geometry/permutation.hpp"
+#include "geometry/perspective.hpp"
+#include "geometry/space.hpp"
+#include "geometry/space_transformations.hpp"
+#include "ksp_plugin/flight_plan.hpp"
+#include "ksp_plugin/frames.hpp"
+#include "ksp_plugin/identification.hpp"
+#include "ksp_plugin/part.hpp"
+#include "ksp_plugin/planetarium.hpp"
+#include "ksp_plugin/plugin.hpp"
+#include "ksp_plugin/vessel.hpp"
+#include "physics/degrees_of_freedom.hpp"
+#include "physics/rigid_motion.hpp"
+#include "physics/solar_system.hpp"
+#include "quantities/elementary_functions.hpp"
+#include "quantities/named_quantities.hpp"
+#include "quantities/quantities.hpp"
+#include "quantities/si.hpp"
+#include "testing_utilities/solar_system_factory.hpp"
+
+namespace principia {
+namespace ksp_plugin {
+
+using namespace principia::astronomy::_frames;
+using namespace principia::base::_not_null;
+using namespace principia::base::_profiler;
+using namespace principia::geometry::_grassmann;
+using namespace principia::geometry::_instant;
+using namespace principia::geometry::_orthogonal_map;
+using namespace principia::geometry::_permutation;
+using namespace principia::geometry::_perspective;
+using namespace principia::geometry::_space;
+using namespace principia::geometry::_space_transformations;
+using namespace principia::ksp_plugin::_flight_plan;
+using namespace principia::ksp_plugin::_frames;
+using namespace principia::ksp_plugin::_identification;
+using namespace principia::ksp_plugin::_part;
+using namespace principia::ksp_plugin::_planetarium;
+using namespace principia::ksp_plugin::_plugin;
+using namespace principia::ksp_plugin::_vessel;
+using namespace principia::physics::_degrees_of_freedom;
+using namespace principia::physics::_rigid_motion;
+using namespace principia::physics::_solar_system;
+using namespace principia::quantities::_elementary_functions;
+using namespace principia::quantities::_named_quantities;
+using namespace principia::quantities::_quantities;
+using namespace principia::quantities::_si;
+using namespace principia::testing_utilities::_solar_system_factory;
+
+namespace {
+
+constexpr char initial_time[] = "JD2451545.0625";
+constexpr Time Δt = 20 * Milli(Second);
+constexpr Angle planetarium_rotation = 1 * Radian;
+
+// The first vessels are loaded, like the active vessel and its neighbours in
+// the physics bubble; every |flight_plan_stride|-th unloaded vessel has a
+// flight plan.
+constexpr int max_loaded_vessels = 2;
+constexpr int flight_plan_stride = 8;
+constexpr Time flight_plan_duration = 6 * Hour;
+
+constexpr Length camera_distance = 100'000 * Kilo(Metre);
+constexpr Length focal = 1 * Metre;
+constexpr int max_points = 10'000;
+
+// The phases of a frame, in the order in which the game calls them.  The names
+// are those of the profiler scopes.
+constexpr char frame_phase[] = "PluginFrame";
+constexpr char advance_time_phase[] = "PluginFrame::AdvanceTime";
+constexpr char insert_or_keep_phase[] = "PluginFrame::InsertOrKeep";
+constexpr char prepare_to_report_collisions_phase[] =
+    "PluginFrame::PrepareToReportCollisions";
+constexpr char free_vessels_phase[] =
+    "PluginFrame::FreeVesselsAndPartsAndCollectPileUps";
+constexpr char catch_up_phase[] = "PluginFrame::CatchUpLaggingVessels";
+constexpr char update_prediction_phase[] = "PluginFrame::UpdatePrediction";
+constexpr char plot_phase[] = "PluginFrame::Plot";
+
+// A synthetic fleet of vessels in low circular orbits around the Earth, at
+// increasing altitudes.
+class Fleet {
+ public:
+  Fleet(int vessels, int parts_per_vessel);
+
+  // Runs a frame of the main loop of the game at time |t|.
+  void RunFrame(Instant const& t);
+
+  Plugin& plugin();
+
+ private:
+  // Inserts or keeps all the vessels, and their parts if they are loaded.
+  void InsertOrKeepVessels();
+
+  void Plot() const;
+
+  bool is_loaded(int vessel_index) const;
+  GUID vessel_guid(int vessel_index) const;
+  PartId part_id(int vessel_index, int part_index) const;
+
+  // The degrees of freedom of the given part with respect to the Earth.
+  RelativeDegreesOfFreedom<AliceSun> PartFromEarth(int vessel_index,
+                                                   int part_index) const;
+
+  int const vessels_;
+  int const parts_per_vessel_;
+  not_null<std::unique_ptr<SolarSystem<ICRS>>> const solar_system_;
+  not_null<std::unique_ptr<Plugin>> const plugin_;
+  std::vector<GUID> active_vessel_guids_;
+};
+
+Fleet::Fleet(int const vessels, int const parts_per_vessel)
+    : vessels_(vessels),
+      parts_per_vessel_(parts_per_vessel),
+      solar_system_(SolarSystemFactory::AtСпутник1Launch(
+          SolarSystemFactory::Accuracy::MinorAndMajorBodies)),
+      plugin_(make_not_null_unique<Plugin>(initial_time,
+                                           initial_time,
+                                           planetarium_rotation)) {
+  for (int index = SolarSystemFactory::Sun;
+       index <= SolarSystemFactory::LastBody;
+       ++index) {
+    std::optional<Index> const parent_index =
+        index == SolarSystemFactory::Sun
+            ? std::nullopt
+            : std::make_optional(SolarSystemFactory::parent(index));
+    plugin_->InsertCelestialAbsoluteCartesian(
+        index,
+        parent_index,
+        solar_system_->gravity_model_message(SolarSystemFactory::name(index)),
+        solar_system_->cartesian_initial_state_message(
+            SolarSystemFactory::name(index)));
+  }
+  plugin_->EndInitialization();
+  plugin_->SetMainBody(SolarSystemFactory::Earth);
+  plugin_->renderer().SetPlottingFrame(
+      plugin_->NewBodyCentredNonRotatingNavigationFrame(
+          SolarSystemFactory::Earth));
+
+  // The loaded parts are given at the beginning of the step, so we must step
+  // once before inserting them.
+  plugin_->AdvanceTime(plugin_->CurrentTime() + Δt, planetarium_rotation);
+  for (int i = 0; i < vessels_; ++i) {
+    bool inserted;
+    plugin_->InsertOrKeepVessel(vessel_guid(i),
+                                "Vessel " + std::to_string(i),
+                                SolarSystemFactory::Earth,
+                                is_loaded(i),
+                                inserted);
+    if (!is_loaded(i)) {
+      for (int j = 0; j < parts_per_vessel_; ++j) {
+        plugin_->InsertUnloadedPart(part_id(i, j),
+                                    "Part " + std::to_string(j),
+                                    vessel_guid(i),
+                                    PartFromEarth(i, j));
+      }
+    }
+  }
+  InsertOrKeepVessels();
+  plugin_->PrepareToReportCollisions();
+  plugin_->FreeVesselsAndPartsAndCollectPileUps(Δt);
+  VesselSet collided_vessels;
+  plugin_->CatchUpLaggingVessels(collided_vessels);
+
+  for (int i = 0; i < vessels_; ++i) {
+    if (is_loaded(i)) {
+      active_vessel_guids_.push_back(vessel_guid(i));
+    } else if (i % flight_plan_stride == 0) {
+      plugin_->CreateFlightPlan(vessel_guid(i),
+                                plugin_->CurrentTime() + flight_plan_duration,
+                                /*initial_mass=*/parts_per_vessel_ * Tonne);
+    }
+  }
+}
+
+void Fleet::RunFrame(Instant const& t) {
+  Profiler::Scope const frame_scope(frame_phase);
+  {
+    Profiler::Scope const scope(advance_time_phase);
+    plugin_->AdvanceTime(t, planetarium_rotation);
+  }
+  {
+    Profiler::Scope const scope(insert_or_keep_phase);
+    InsertOrKeepVessels();
+  }
+  {
+    Profiler::Scope const scope(prepare_to_report_collisions_phase);
+    plugin_->PrepareToReportCollisions();
+  }
+  {
+    Profiler::Scope const scope(free_vessels_phase);
+    plugin_->FreeVesselsAndPartsAndCollectPileUps(Δt);
+  }
+  {
+    Profiler::Scope const scope(catch_up_phase);
+    VesselSet collided_vessels;
+    plugin_->CatchUpLaggingVessels(collided_vessels);
+  }
+  {
+    Profiler::Scope const scope(update_prediction_phase);
+    plugin_->UpdatePrediction(active_vessel_guids_);
+  }
+  {
+    Profiler::Scope const scope(plot_phase);
+    Plot();
+  }
+}
+
+Plugin& Fleet::plugin() {
+  return *plugin_;
+}
+
+void Fleet::InsertOrKeepVessels() {
+  // The main body is at the origin of |World| and the parts are placed using
+  // the same mapping from |AliceSun| as the plugin integration test.
+  Permutation<AliceSun, World> const alice_sun_to_world(OddPermutation::XZY);
+  DegreesOfFreedom<World> const earth_degrees_of_freedom = {World::origin,
+                                                            World::unmoving};
+  for (int i = 0; i < vessels_; ++i) {
+    bool inserted;
+    plugin_->InsertOrKeepVessel(vessel_guid(i),
+                                "Vessel " + std::to_string(i),
+                                SolarSystemFactory::Earth,
+                                is_loaded(i),
+                                inserted);
+    if (is_loaded(i)) {
+      for (int j = 0; j < parts_per_vessel_; ++j) {
+        RelativeDegreesOfFreedom<AliceSun> const part_from_earth =
+            PartFromEarth(i, j);
+        plugin_->InsertOrKeepLoadedPart(
+            part_id(i, j),
+            "Part " + std::to_string(j),
+            1 * Tonne,
+            EccentricPart::origin,
+            MakeWaterSphereInertiaTensor(1 * Tonne),
+            /*is_solid_rocket_motor=*/false,
+            vessel_guid(i),
+            SolarSystemFactory::Earth,
+            earth_degrees_of_freedom,
+            RigidMotion<EccentricPart, World>::MakeNonRotatingMotion(
+                earth_degrees_of_freedom +
+                RelativeDegreesOfFreedom<World>(
+                    alice_sun_to_world(part_from_earth.displacement()),
+                    alice_sun_to_world(part_from_earth.velocity()))),
+            Δt);
+      }
+    }
+  }
+}
+
+void Fleet::Plot() const {
+  // The game creates a new planetarium for each frame.  The camera looks at
+  // the Earth from a fixed distance.
+  Similarity<World, Navigation> const world_to_plotting =
+      plugin_->renderer().WorldToPlotting(plugin_->CurrentTime(),
+                                          /*sun_world_position=*/World::origin,
+                                          plugin_->PlanetariumRotation());
+  Position<World> const earth_world_position =
+      world_to_plotting.Inverse()(Navigation::origin);
+  RigidTransformation<Camera, World> const camera_to_world(
+      Camera::origin,
+      earth_world_position +
+          Displacement<World>({0 * Metre, 0 * Metre, -camera_distance}),
+      OrthogonalMap<Camera, World>::Identity());
+  auto const planetarium = plugin_->NewPlanetarium(
+      Planetarium::Parameters(/*sphere_radius_multiplier=*/1.0,
+                              /*angular_resolution=*/0.4 * ArcMinute,
+                              /*field_of_view=*/90 * Degree),
+      Perspective<Navigation, Camera>(
+          world_to_plotting * camera_to_world.Forget<Similarity>(), focal),
+      [](Position<Navigation> const& plotted_point) {
+        return ScaledSpacePoint::FromCoordinates(
+            ((plotted_point - Navigation::origin) / Metre).coordinates());
+      });
+
+  std::int64_t points = 0;
+  auto const add_point = [&points](ScaledSpacePoint const&) { ++points; };
+  for (GUID const& vessel_guid : active_vessel_guids_) {
+    auto const prediction = plugin_->GetVessel(vessel_guid)->prediction();
+    planetarium->PlotMethod3(*prediction,
+                             prediction->begin(),
+                             prediction->end(),
+                             plugin_->CurrentTime(),
+                             /*t_max=*/InfiniteFuture,
+                             /*reverse=*/false,
+                             add_point,
+                             max_points);
+  }
+  for (int i = 0; i < vessels_; ++i) {
+    Vessel const& vessel = *plugin_->GetVessel(vessel_guid(i));
+    if (!vessel.has_flight_plan()) {
+      continue;
+    }
+    FlightPlan const& flight_plan = vessel.flight_plan();
+    for (int j = 0; j < flight_plan.number_of_segments(); ++j) {
+      auto const segment = flight_plan.GetSegment(j);
+      planetarium->PlotMethod3(*segment,
+                               segment->begin(),
+                               segment->end(),
+                               plugin_->CurrentTime(),
+                               /*t_max=*/InfiniteFuture,
+                               /*reverse=*/false,
+                               add_point,
+                               max_points);
+    }
+  }
+  benchmark::DoNotOptimize(points);
+}
+
+bool Fleet::is_loaded(int const vessel_index) const {
+  return vessel_index < max_loaded_vessels;
+}
+
+GUID Fleet::vessel_guid(int const vessel_index) const {
+  return "vessel-" + std::to_string(vessel_index);
+}
+
+PartId Fleet::part_id(int const vessel_index, int const part_index) const {
+  return vessel_index * parts_per_vessel_ + part_index;
+}
+
+RelativeDegreesOfFreedom<AliceSun> Fleet::PartFromEarth(
+    int const vessel_index,
+    int const part_index) const {
+  // The vessels are 10 km apart in altitude, and their parts are 1 m apart.
+  Length const radius = 6'800 * Kilo(Metre) + vessel_index * 10 * Kilo(Metre);
+  Displacement<AliceSun> const displacement(
+      {radius + part_index * Metre, 0 * Metre, 0 * Metre});
+  Velocity<AliceSun> const velocity(
+      {0 * Metre / Second,
+       Sqrt(solar_system_->gravitational_parameter(
+                SolarSystemFactory::name(SolarSystemFactory::Earth)) /
+            radius),
+       0 * Metre / Second});
+  return {displacement, velocity};
+}
+
+}  // namespace
+
+// Measures a frame of the main loop of the game for a fleet of
+// |state.range(0)| vessels of |state.range(1)| parts each.  The time per
+// iteration is that of a complete frame; the counters give the distribution of
+// the time spent in each phase of the frame, in microseconds.
+void BM_PluginFrame(benchmark::State& state) {
+  int const vessels = state.range(0);
+  int const parts_per_vessel = state.range(1);
+  Fleet fleet(vessels, parts_per_vessel);
+
+  Profiler::Clear();
+  Profiler::Enable(true);
+  Instant t = fleet.plugin().CurrentTime();
+  for (auto _ : state) {
+    t += Δt;
+    fleet.RunFrame(t);
+  }
+  Profiler::Enable(false);
+
+  using Microseconds = std::chrono::duration<double, std::micro>;
+  for (auto const& statistics : Profiler::ComputeStatistics()) {
+    if (!statistics.name.starts_with(frame_phase)) {
+      continue;
+    }
+    state.counters[statistics.name + " p50"] =
+        Microseconds(statistics.p50).count();
+    state.counters[statistics.name + " p99"] =
+        Microseconds(statistics.p99).count();
+    state.counters[statistics.name + " max"] =
+        Microseconds(statistics.max).count();
+  }
+  Profiler::Clear();
+}
+
+BENCHMARK(BM_PluginFrame)
+    ->ArgsProduct({{1, 10, 100, 1000}, {1, 10}})
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace ksp_plugin
+}  // namespace principia
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <optional>
 #include <utility>
 #include <vector>
@@ -82,7 +83,26 @@ class Perspective final {
       Segment<FromFrame> const& segment,
       std::vector<Sphere<FromFrame>> const& spheres) const;
 
+  // Same as calling the above for each element of |segments| and
+  // concatenating the results, but much faster when there are many segments.
+  // The segments are recursively split into chunks, each bounded by a cone
+  // with its apex at the camera.  A sphere is only tested against the segments
+  // of a chunk if its apparent disk overlaps the cone of the chunk and the
+  // chunk is not entirely in front of it.  A chunk that is entirely hidden by a
+  // sphere is dropped without looking at its segments.
+  Segments<FromFrame> VisibleSegments(
+      Segments<FromFrame> const& segments,
+      std::vector<Sphere<FromFrame>> const& spheres) const;
+
  private:
+  // Appends to |visible_segments| the visible parts of the segments in
+  // |segments[begin, end[|.
+  void AppendVisibleSegments(Segments<FromFrame> const& segments,
+                             std::int64_t begin,
+                             std::int64_t end,
+                             std::vector<Sphere<FromFrame>> const& spheres,
+                             Segments<FromFrame>& visible_segments) const;
+
   Similarity<ToFrame, FromFrame> const from_camera_;
   Similarity<FromFrame, ToFrame> const to_camera_;
   Position<FromFrame> const camera_;
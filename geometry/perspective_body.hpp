@@ -3,6 +3,7 @@
 #include "geometry/perspective.hpp"
 
 #include <algorithm>
+#include <cstdint>
 #include <limits>
 #include <utility>
 #include <vector>
@@ -12,6 +13,8 @@
 #include "geometry/r3_element.hpp"
 #include "numerics/root_finders.hpp"
 #include "quantities/elementary_functions.hpp"
+#include "quantities/numbers.hpp"  // 🧙 For π.
+#include "quantities/si.hpp"
 
 namespace principia {
 namespace geometry {
@@ -23,6 +26,7 @@ using namespace principia::geometry::_grassmann;
 using namespace principia::geometry::_r3_element;
 using namespace principia::numerics::_root_finders;
 using namespace principia::quantities::_elementary_functions;
+using namespace principia::quantities::_si;
 
 template<typename FromFrame, typename ToFrame>
 Perspective<FromFrame, ToFrame>::Perspective(
@@ -420,6 +424,121 @@ Segments<FromFrame> Perspective<FromFrame, ToFrame>::VisibleSegments(
   return segments;
 }
 
+template<typename FromFrame, typename ToFrame>
+Segments<FromFrame> Perspective<FromFrame, ToFrame>::VisibleSegments(
+    Segments<FromFrame> const& segments,
+    std::vector<Sphere<FromFrame>> const& spheres) const {
+  Segments<FromFrame> visible_segments;
+  visible_segments.reserve(segments.size());
+  AppendVisibleSegments(segments,
+                        /*begin=*/0,
+                        /*end=*/segments.size(),
+                        spheres,
+                        visible_segments);
+  return visible_segments;
+}
+
+template<typename FromFrame, typename ToFrame>
+void Perspective<FromFrame, ToFrame>::AppendVisibleSegments(
+    Segments<FromFrame> const& segments,
+    std::int64_t const begin,
+    std::int64_t const end,
+    std::vector<Sphere<FromFrame>> const& spheres,
+    Segments<FromFrame>& visible_segments) const {
+  // Below this size, the chunks are not worth bounding.
+  constexpr std::int64_t leaf_size = 8;
+  // The angles computed below may be slightly off; this margin makes the
+  // culling conservative.
+  constexpr Angle angular_margin = 1e-9 * Radian;
+
+  if (spheres.empty()) {
+    visible_segments.insert(visible_segments.end(),
+                            segments.begin() + begin,
+                            segments.begin() + end);
+    return;
+  }
+  if (end - begin <= leaf_size) {
+    for (std::int64_t i = begin; i < end; ++i) {
+      auto const visible = VisibleSegments(segments[i], spheres);
+      visible_segments.insert(
+          visible_segments.end(), visible.begin(), visible.end());
+    }
+    return;
+  }
+
+  // K is the position of the camera, P an extremity of a segment of the chunk.
+  // The chunk is bounded by the cone of the given |axis| and |half_angle|, and
+  // its points are between |min_distance| and |max_distance| from K.
+  Position<FromFrame> const& K = camera_;
+  Vector<double, FromFrame> axis;
+  for (std::int64_t i = begin; i < end; ++i) {
+    axis += NormalizeOrZero(segments[i].first - K);
+    axis += NormalizeOrZero(segments[i].second - K);
+  }
+  axis = NormalizeOrZero(axis);
+  Angle half_angle;
+  Square<Length> max_distance²;
+  Square<Length> min_distance² = Infinity<Square<Length>>;
+  for (std::int64_t i = begin; i < end; ++i) {
+    auto const& [A, B] = segments[i];
+    Displacement<FromFrame> const KA = A - K;
+    Displacement<FromFrame> const KB = B - K;
+    half_angle = std::max({half_angle,
+                           AngleBetween(axis, KA),
+                           AngleBetween(axis, KB)});
+    max_distance² = std::max({max_distance², KA.Norm²(), KB.Norm²()});
+    // The point of the segment closest to K.
+    Displacement<FromFrame> const AB = B - A;
+    auto const AB² = AB.Norm²();
+    double const λ = AB² == Square<Length>{}
+                         ? 0
+                         : std::clamp(-InnerProduct(KA, AB) / AB², 0.0, 1.0);
+    min_distance² = std::min(min_distance², (KA + λ * AB).Norm²());
+  }
+
+  std::int64_t const mid = begin + (end - begin) / 2;
+  if (axis == Vector<double, FromFrame>{} || half_angle >= π / 2 * Radian) {
+    // The chunk is too wide to be bounded by a convex cone.
+    AppendVisibleSegments(segments, begin, mid, spheres, visible_segments);
+    AppendVisibleSegments(segments, mid, end, spheres, visible_segments);
+    return;
+  }
+
+  // The spheres that may hide part of the chunk.
+  std::vector<Sphere<FromFrame>> hiding_spheres;
+  for (auto const& sphere : spheres) {
+    // C is the centre of the sphere.
+    Displacement<FromFrame> const KC = sphere.centre() - K;
+    auto const KC² = KC.Norm²();
+    if (KC² <= sphere.radius²()) {
+      // The camera is inside the sphere, everything is hidden.
+      return;
+    }
+    Length const KC_norm = Sqrt(KC²);
+    Length const near_distance = KC_norm - sphere.radius();
+    if (max_distance² <= near_distance * near_distance) {
+      // The chunk is entirely in front of the sphere.
+      continue;
+    }
+    // The sphere is seen under a cone of half-angle |sphere_half_angle|.
+    Angle const sphere_half_angle = ArcSin(sphere.radius() / KC_norm);
+    Angle const axis_to_centre = AngleBetween(axis, KC);
+    if (axis_to_centre >= half_angle + sphere_half_angle + angular_margin) {
+      // The cones are disjoint.
+      continue;
+    }
+    if (axis_to_centre + half_angle + angular_margin <= sphere_half_angle &&
+        min_distance² >= KC²) {
+      // The chunk is within the cone of the sphere and behind its centre, so
+      // it is entirely hidden.
+      return;
+    }
+    hiding_spheres.push_back(sphere);
+  }
+  AppendVisibleSegments(segments, begin, mid, hiding_spheres, visible_segments);
+  AppendVisibleSegments(segments, mid, end, hiding_spheres, visible_segments);
+}
+
 template<typename FromFrame, typename ToFrame>
 std::ostream& operator<<(std::ostream& out,
                          Perspective<FromFrame, ToFrame> const& perspective) {
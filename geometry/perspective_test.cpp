@@ -1,6 +1,7 @@
 #include "geometry/perspective.hpp"
 
 #include <limits>
+#include <vector>
 
 #include "geometry/frame.hpp"
 #include "geometry/orthogonal_map.hpp"
@@ -23,6 +24,7 @@ namespace geometry {
 using ::testing::Eq;
 using ::testing::ElementsAre;
 using ::testing::IsEmpty;
+using ::testing::Lt;
 using ::testing::Pair;
 using ::testing::SizeIs;
 using ::testing::_;
@@ -622,5 +624,48 @@ TEST_F(VisibleSegmentsTest, MultipleSpheres) {
               SizeIs(3));
 }
 
+// A long polyline hidden by several spheres: the culling of the chunks must
+// give the same result as hiding each segment independently.
+TEST_F(VisibleSegmentsTest, ManySegments) {
+  std::vector<Sphere<World>> const spheres{
+      sphere_,
+      Sphere<World>(
+          World::origin +
+              Displacement<World>({5 * Metre, 3 * Metre, -1 * Metre}),
+          /*radius=*/0.5 * Metre),
+      Sphere<World>(
+          World::origin +
+              Displacement<World>({-50 * Metre, 40 * Metre, 0 * Metre}),
+          /*radius=*/2 * Metre)};
+  Segments<World> segments;
+  Position<World> previous_point;
+  // A helix behind the sphere at the origin, whose radius increases so that it
+  // goes from completely hidden to completely visible.
+  for (int i = 0; i <= 1000; ++i) {
+    double const t = i / 100.0;
+    Length const radius = (0.5 + 0.3 * t) * Metre;
+    Position<World> const point =
+        World::origin + Displacement<World>({(10 - t) * Metre,
+                                             radius * Cos(t * Radian),
+                                             radius * Sin(t * Radian)});
+    if (i > 0) {
+      segments.emplace_back(previous_point, point);
+    }
+    previous_point = point;
+  }
+
+  Segments<World> expected_segments;
+  for (auto const& segment : segments) {
+    auto const visible_segments =
+        perspective_.VisibleSegments(segment, spheres);
+    expected_segments.insert(expected_segments.end(),
+                             visible_segments.begin(),
+                             visible_segments.end());
+  }
+  auto const actual_segments = perspective_.VisibleSegments(segments, spheres);
+  EXPECT_THAT(actual_segments, SizeIs(Lt(segments.size())));
+  EXPECT_EQ(expected_segments, actual_segments);
+}
+
 }  // namespace geometry
 }  // namespace principia
@@ -1,11 +1,13 @@
 #pragma once
 
-#include <functional>
 #include <memory>
+#include <optional>
 #include <type_traits>
+#include <variant>
 
 #include "base/not_constructible.hpp"
 #include "base/not_null.hpp"
+#include "base/profiler.hpp"
 #include "journal/concepts.hpp"
 
 namespace principia {
@@ -15,6 +17,7 @@ namespace internal {
 
 using namespace principia::base::_not_constructible;
 using namespace principia::base::_not_null;
+using namespace principia::base::_profiler;
 using namespace principia::journal::_concepts;
 
 // The parameter |Profile| is expected to have the following structure:
@@ -29,6 +32,7 @@ using namespace principia::journal::_concepts;
 //    using Return = ...;  // Only present if the profile does not return void.
 //
 //    using Message = serialization::SerializePlugin;
+//    static constexpr char name[] = "SerializePlugin";
 //
 //    // The following functions must be omitted if In/Out/Return is omitted.
 //    static void Fill(In const& in, not_null<Message*> message);
@@ -39,6 +43,33 @@ using namespace principia::journal::_concepts;
 //                    not_null<Player::PointerMap*> pointer_map);
 //  };
 
+// The types of the |Out| and |Return| parameters of |Profile|, or
+// |std::monostate| if it doesn't have them.
+template<typename Profile>
+struct OutParameters {
+  using type = std::monostate;
+};
+
+template<typename Profile>
+  requires has_out<Profile>
+struct OutParameters<Profile> {
+  using type = typename Profile::Out;
+};
+
+template<typename Profile>
+struct ReturnParameter {
+  using type = std::monostate;
+};
+
+template<typename Profile>
+  requires has_return<Profile>
+struct ReturnParameter<Profile> {
+  using type = typename Profile::Return;
+};
+
+// When no journal is active, a |Method| only holds a flag and a profiling scope
+// and does nothing beyond testing the active recorder: it doesn't build a
+// message, allocate, or capture its parameters.
 template<typename Profile>
 class Method final {
  public:
@@ -74,10 +105,13 @@ class Method final {
     requires has_return<P>;
 
  private:
-  std::function<void(not_null<typename Profile::Message*> message)> out_filler_;
-  std::function<void(not_null<typename Profile::Message*> message)>
-      return_filler_;
+  // These are only engaged if a journal is active.  They are written to the
+  // message at destruction.
+  std::optional<typename OutParameters<Profile>::type> out_;
+  std::optional<typename ReturnParameter<Profile>::type> result_;
   bool returned_ = false;
+  // Every interface call is profiled under the name of its message.
+  Profiler::Scope const profiler_scope_{Profile::name};
 };
 
 }  // namespace internal
@@ -15,7 +15,7 @@ using namespace principia::journal::_recorder;
 
 template<typename Profile>
 Method<Profile>::Method() {
-  if (Recorder::active_recorder_ != nullptr) {
+  if (Recorder::active_recorder_ != nullptr) [[unlikely]] {
     serialization::Method method;
     [[maybe_unused]] auto* const message_in =
         method.MutableExtension(Profile::Message::extension);
@@ -27,7 +27,7 @@ template<typename Profile>
 template<typename P>
 Method<Profile>::Method(typename P::In const& in)
   requires has_in<P> && (!has_out<P>) {
-  if (Recorder::active_recorder_ != nullptr) {
+  if (Recorder::active_recorder_ != nullptr) [[unlikely]] {
     serialization::Method method;
     auto* const message_in =
         method.MutableExtension(Profile::Message::extension);
@@ -40,15 +40,12 @@ template<typename Profile>
 template<typename P>
 Method<Profile>::Method(typename P::Out const& out)
   requires has_out<P> && (!has_in<P>) {
-  if (Recorder::active_recorder_ != nullptr) {
+  if (Recorder::active_recorder_ != nullptr) [[unlikely]] {
     serialization::Method method;
     [[maybe_unused]] auto* const message_in =
         method.MutableExtension(Profile::Message::extension);
     Recorder::active_recorder_->WriteAtConstruction(method);
-    out_filler_ = [out](
-        not_null<typename Profile::Message*> const message) {
-      Profile::Fill(out, message);
-    };
+    out_.emplace(out);
   }
 }
 
@@ -57,31 +54,32 @@ template<typename P>
 Method<Profile>::Method(typename P::In const& in,
                         typename P::Out const& out)
   requires has_in<P> && has_out<P> {
-  if (Recorder::active_recorder_ != nullptr) {
+  if (Recorder::active_recorder_ != nullptr) [[unlikely]] {
     serialization::Method method;
     auto* const message_in =
         method.MutableExtension(Profile::Message::extension);
     Profile::Fill(in, message_in);
     Recorder::active_recorder_->WriteAtConstruction(method);
-    out_filler_ = [out](
-        not_null<typename Profile::Message*> const message) {
-      Profile::Fill(out, message);
-    };
+    out_.emplace(out);
   }
 }
 
 template<typename Profile>
 Method<Profile>::~Method() {
   CHECK(returned_);
-  if (Recorder::active_recorder_ != nullptr) {
+  if (Recorder::active_recorder_ != nullptr) [[unlikely]] {
     serialization::Method method;
     auto* const extension =
         method.MutableExtension(Profile::Message::extension);
-    if (out_filler_ != nullptr) {
-      out_filler_(extension);
+    if constexpr (has_out<Profile>) {
+      if (out_.has_value()) {
+        Profile::Fill(*out_, extension);
+      }
     }
-    if (return_filler_ != nullptr) {
-      return_filler_(extension);
+    if constexpr (has_return<Profile>) {
+      if (result_.has_value()) {
+        Profile::Fill(*result_, extension);
+      }
     }
     Recorder::active_recorder_->WriteAtDestruction(method);
   }
@@ -102,11 +100,8 @@ typename P::Return Method<Profile>::Return(
   requires has_return<P> {
   CHECK(!returned_);
   returned_ = true;
-  if (Recorder::active_recorder_ != nullptr) {
-    return_filler_ =
-        [result](not_null<typename Profile::Message*> const message) {
-          Profile::Fill(result, message);
-        };
+  if (Recorder::active_recorder_ != nullptr) [[unlikely]] {
+    result_.emplace(result);
   }
   return result;
 }
@@ -50,6 +50,10 @@ serialization::Method const& Player::last_method_out_return() const {
   return *last_method_out_return_;
 }
 
+ReplayLatencies const& Player::latencies() const {
+  return latencies_;
+}
+
 std::unique_ptr<serialization::Method> Player::Read() {
   std::string const line = GetLine(stream_);
   if (line.empty()) {
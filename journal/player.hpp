@@ -5,6 +5,7 @@
 #include <map>
 #include <memory>
 
+#include "journal/replay_latencies.hpp"
 #include "serialization/journal.pb.h"
 
 namespace principia {
@@ -16,6 +17,8 @@ class RecorderTest;
 namespace _player {
 namespace internal {
 
+using namespace principia::journal::_replay_latencies;
+
 class Player final {
  public:
   using PointerMap = std::map<std::uint64_t, void*>;
@@ -33,6 +36,10 @@ class Player final {
   serialization::Method const& last_method_in() const;
   serialization::Method const& last_method_out_return() const;
 
+  // The latencies of the interface methods run by |Play|, by method name.  The
+  // time spent parsing and merging the messages is excluded.
+  ReplayLatencies const& latencies() const;
+
  private:
   // Reads one message from the stream.  Returns a |nullptr| at end of stream.
   std::unique_ptr<serialization::Method> Read();
@@ -51,6 +58,8 @@ class Player final {
   std::unique_ptr<serialization::Method> last_method_in_;
   std::unique_ptr<serialization::Method> last_method_out_return_;
 
+  ReplayLatencies latencies_;
+
   friend class journal::PlayerTest;
   friend class journal::RecorderTest;
 };
@@ -2,6 +2,7 @@
 
 #include "journal/player.hpp"
 
+#include <chrono>
 #include <list>
 
 #include "glog/logging.h"
@@ -21,8 +22,11 @@ bool Player::RunIfAppropriate(serialization::Method const& method_in,
         << method_out_return.DebugString();
     serialization::Method merged_method = method_in;
     merged_method.MergeFrom(method_out_return);
+    auto const before = std::chrono::steady_clock::now();
     Profile::Run(merged_method.GetExtension(Profile::Message::extension),
                  pointer_map_);
+    auto const after = std::chrono::steady_clock::now();
+    latencies_.Record(Profile::name, after - before);
     return true;
   }
   return false;
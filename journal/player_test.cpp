@@ -7,19 +7,24 @@
 
 #include "benchmark/benchmark.h"
 #include "glog/logging.h"
+#include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "journal/method.hpp"
 #include "journal/profiles.hpp"  // 🧙 For generated profiles.
 #include "journal/recorder.hpp"
+#include "journal/replay_latencies.hpp"
 #include "ksp_plugin/plugin.hpp"
 #include "serialization/journal.pb.h"
 
 namespace principia {
 namespace journal {
 
+using ::testing::ElementsAre;
+using ::testing::Field;
 using namespace principia::journal::_method;
 using namespace principia::journal::_player;
 using namespace principia::journal::_recorder;
+using namespace principia::journal::_replay_latencies;
 using namespace principia::ksp_plugin::_plugin;
 using namespace std::chrono_literals;
 
@@ -84,6 +89,11 @@ TEST_F(PlayerTest, PlayTiny) {
     ++count;
   }
   EXPECT_EQ(3, count);
+  EXPECT_THAT(
+      player.latencies().Summarize(),
+      ElementsAre(Field(&ReplayLatencies::Summary::name, "DeletePlugin"),
+                  Field(&ReplayLatencies::Summary::name, "GetVersion"),
+                  Field(&ReplayLatencies::Summary::name, "NewPlugin")));
 }
 
 TEST_F(PlayerTest, DISABLED_SECULAR_Benchmarks) {
@@ -109,6 +119,44 @@ TEST_F(PlayerTest, DISABLED_SECULAR_Scan) {
              << player.last_method_out_return().DebugString();
 }
 
+// A test to measure the latencies of the methods of a journal, e.g., for
+// performance regression testing.  You must set |path|.  The latencies are
+// written next to the journal, with a suffix that identifies the build.
+TEST_F(PlayerTest, DISABLED_SECULAR_Latencies) {
+  std::string path =
+      R"(P:\Public Mockingbird\Principia\Journals\JOURNAL.20180311-192733)";
+  std::string build = "baseline";
+  Player player(path);
+  int count = 0;
+  while (player.Play(count)) {
+    ++count;
+    LOG_IF(ERROR, (count % 100'000) == 0) << count
+                                          << " journal entries replayed";
+  }
+  LOG(ERROR) << count << " journal entries in total";
+  player.latencies().WriteToFile(path + "." + build + ".latencies.txt");
+  for (auto const& summary : player.latencies().Summarize()) {
+    LOG(ERROR) << summary.name << ": " << summary.count << " calls, p50 "
+               << summary.p50 / 1us << " µs, p99 " << summary.p99 / 1us
+               << " µs, max " << summary.max / 1us << " µs, total "
+               << summary.total / 1ms << " ms";
+  }
+}
+
+// A test to compare the latencies measured by |DISABLED_SECULAR_Latencies| for
+// two builds.  You must set |path| and the suffixes of the two builds.
+TEST_F(PlayerTest, DISABLED_SECULAR_CompareLatencies) {
+  std::string path =
+      R"(P:\Public Mockingbird\Principia\Journals\JOURNAL.20180311-192733)";
+  std::string baseline_build = "baseline";
+  std::string candidate_build = "candidate";
+  auto const baseline = ReplayLatencies::ReadFromFile(
+      path + "." + baseline_build + ".latencies.txt");
+  auto const candidate = ReplayLatencies::ReadFromFile(
+      path + "." + candidate_build + ".latencies.txt");
+  LOG(ERROR) << "\n" << ReplayLatencies::Compare(baseline, candidate);
+}
+
 // A test to debug a journal.  You must set |path| and fill the |method_in| and
 // |method_out_return| protocol buffers.
 TEST_F(PlayerTest, DISABLED_SECULAR_Debug) {
@@ -0,0 +1,183 @@
+#include "journal/replay_latencies.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <string_view>
+#include <utility>
+
+#include "absl/strings/str_format.h"
+#include "glog/logging.h"
+
+namespace principia {
+namespace journal {
+namespace _replay_latencies {
+namespace internal {
+
+namespace {
+
+using Microseconds = std::chrono::duration<double, std::micro>;
+
+double ToMicroseconds(std::chrono::nanoseconds const duration) {
+  return Microseconds(duration).count();
+}
+
+}  // namespace
+
+void ReplayLatencies::Record(std::string_view const method,
+                             std::chrono::nanoseconds const latency) {
+  auto it = histograms_.find(method);
+  if (it == histograms_.end()) {
+    it = histograms_.emplace(std::string(method), Histogram{}).first;
+  }
+  Histogram& histogram = it->second;
+  ++histogram.count;
+  histogram.total += latency;
+  histogram.max = std::max(histogram.max, latency);
+  int const bucket = static_cast<int>(std::floor(
+      buckets_per_octave * std::log2(std::max<double>(latency.count(), 1))));
+  if (bucket >= histogram.buckets.size()) {
+    histogram.buckets.resize(bucket + 1);
+  }
+  ++histogram.buckets[bucket];
+}
+
+std::vector<ReplayLatencies::Summary> ReplayLatencies::Summarize() const {
+  std::vector<Summary> summaries;
+  for (auto const& [name, histogram] : histograms_) {
+    summaries.push_back({.name = name,
+                         .count = histogram.count,
+                         .total = histogram.total,
+                         .p50 = Percentile(histogram, 0.5),
+                         .p99 = Percentile(histogram, 0.99),
+                         .max = histogram.max});
+  }
+  return summaries;
+}
+
+void ReplayLatencies::WriteToFile(std::filesystem::path const& path) const {
+  std::ofstream stream(path, std::ios::out);
+  CHECK(!stream.fail()) << path;
+  for (auto const& [name, histogram] : histograms_) {
+    stream << name << " " << histogram.count << " "
+           << histogram.total.count() << " " << histogram.max.count();
+    for (int i = 0; i < histogram.buckets.size(); ++i) {
+      if (histogram.buckets[i] > 0) {
+        stream << " " << i << ":" << histogram.buckets[i];
+      }
+    }
+    stream << "\n";
+  }
+  CHECK(!stream.fail()) << path;
+}
+
+ReplayLatencies ReplayLatencies::ReadFromFile(
+    std::filesystem::path const& path) {
+  std::ifstream stream(path, std::ios::in);
+  CHECK(!stream.fail()) << path;
+  ReplayLatencies latencies;
+  std::string line;
+  while (std::getline(stream, line)) {
+    std::istringstream fields(line);
+    std::string name;
+    Histogram histogram;
+    std::int64_t total;
+    std::int64_t max;
+    fields >> name >> histogram.count >> total >> max;
+    CHECK(!fields.fail()) << path << ": " << line;
+    histogram.total = std::chrono::nanoseconds(total);
+    histogram.max = std::chrono::nanoseconds(max);
+    int index;
+    char colon;
+    std::int64_t count;
+    while (fields >> index >> colon >> count) {
+      CHECK_EQ(':', colon) << path << ": " << line;
+      if (index >= histogram.buckets.size()) {
+        histogram.buckets.resize(index + 1);
+      }
+      histogram.buckets[index] = count;
+    }
+    latencies.histograms_.emplace(std::move(name), std::move(histogram));
+  }
+  return latencies;
+}
+
+std::string ReplayLatencies::Compare(ReplayLatencies const& baseline,
+                                     ReplayLatencies const& candidate) {
+  std::set<std::string_view> names;
+  for (auto const& [name, _] : baseline.histograms_) {
+    names.insert(name);
+  }
+  for (auto const& [name, _] : candidate.histograms_) {
+    names.insert(name);
+  }
+
+  // The latencies are in µs, the ratios are those of the candidate to the
+  // baseline.
+  std::string table = absl::StrFormat(
+      "%-40s %10s %10s %10s %7s %10s %10s %7s %12s %12s %7s\n",
+      "method", "count",
+      "p50 base", "p50 cand", "ratio",
+      "p99 base", "p99 cand", "ratio",
+      "total base", "total cand", "ratio");
+  for (std::string_view const name : names) {
+    auto const baseline_it = baseline.histograms_.find(name);
+    auto const candidate_it = candidate.histograms_.find(name);
+    if (baseline_it == baseline.histograms_.end() ||
+        candidate_it == candidate.histograms_.end()) {
+      Histogram const& histogram =
+          baseline_it == baseline.histograms_.end() ? candidate_it->second
+                                                    : baseline_it->second;
+      absl::StrAppendFormat(
+          &table,
+          "%-40s %10d only in the %s\n",
+          name,
+          histogram.count,
+          baseline_it == baseline.histograms_.end() ? "candidate"
+                                                    : "baseline");
+      continue;
+    }
+    Histogram const& b = baseline_it->second;
+    Histogram const& c = candidate_it->second;
+    double const b_p50 = ToMicroseconds(Percentile(b, 0.5));
+    double const c_p50 = ToMicroseconds(Percentile(c, 0.5));
+    double const b_p99 = ToMicroseconds(Percentile(b, 0.99));
+    double const c_p99 = ToMicroseconds(Percentile(c, 0.99));
+    double const b_total = ToMicroseconds(b.total);
+    double const c_total = ToMicroseconds(c.total);
+    absl::StrAppendFormat(
+        &table,
+        "%-40s %10d %10.1f %10.1f %7.3f %10.1f %10.1f %7.3f %12.0f %12.0f "
+        "%7.3f\n",
+        name, c.count,
+        b_p50, c_p50, c_p50 / b_p50,
+        b_p99, c_p99, c_p99 / b_p99,
+        b_total, c_total, c_total / b_total);
+  }
+  return table;
+}
+
+std::chrono::nanoseconds ReplayLatencies::Percentile(
+    Histogram const& histogram,
+    double const p) {
+  std::int64_t const rank = std::max<std::int64_t>(
+      std::ceil(p * histogram.count), 1);
+  std::int64_t cumulative_count = 0;
+  for (int i = 0; i < histogram.buckets.size(); ++i) {
+    cumulative_count += histogram.buckets[i];
+    if (cumulative_count >= rank) {
+      std::chrono::nanoseconds const upper_bound(static_cast<std::int64_t>(
+          std::ceil(std::exp2(static_cast<double>(i + 1) /
+                              buckets_per_octave))));
+      return std::min(upper_bound, histogram.max);
+    }
+  }
+  return histogram.max;
+}
+
+}  // namespace internal
+}  // namespace _replay_latencies
+}  // namespace journal
+}  // namespace principia
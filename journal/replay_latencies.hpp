@@ -0,0 +1,75 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace principia {
+namespace journal {
+namespace _replay_latencies {
+namespace internal {
+
+// The latencies of the interface methods replayed from a journal, aggregated
+// as a logarithmic histogram per method.  The latencies of a replay may be
+// written to a file, so that replays of the same journal by different builds
+// may be compared.
+class ReplayLatencies final {
+ public:
+  // The number of buckets of the histograms for each power of 2.  The
+  // percentiles are accurate to 2^(1/buckets_per_octave), i.e., about 9%.
+  static constexpr int buckets_per_octave = 8;
+
+  struct Summary final {
+    std::string name;
+    std::int64_t count;
+    std::chrono::nanoseconds total;
+    std::chrono::nanoseconds p50;
+    std::chrono::nanoseconds p99;
+    std::chrono::nanoseconds max;
+  };
+
+  void Record(std::string_view method, std::chrono::nanoseconds latency);
+
+  // Returns the statistics of each method, by increasing name.
+  std::vector<Summary> Summarize() const;
+
+  // The file contains one line per method, made of its name, count, total and
+  // maximum latency, followed by the nonempty buckets of its histogram as
+  // |index:count| pairs.
+  void WriteToFile(std::filesystem::path const& path) const;
+  static ReplayLatencies ReadFromFile(std::filesystem::path const& path);
+
+  // Returns a table comparing the latencies of each method in |baseline| and
+  // |candidate|, with the ratios of the candidate to the baseline.
+  static std::string Compare(ReplayLatencies const& baseline,
+                             ReplayLatencies const& candidate);
+
+ private:
+  struct Histogram final {
+    std::int64_t count = 0;
+    std::chrono::nanoseconds total{};
+    std::chrono::nanoseconds max{};
+    // |buckets[i]| is the number of latencies in
+    // [2^(i/buckets_per_octave), 2^((i+1)/buckets_per_octave)[ ns.
+    std::vector<std::int64_t> buckets;
+  };
+
+  // Returns an upper bound of the latency of rank ⌈p count⌉.
+  static std::chrono::nanoseconds Percentile(Histogram const& histogram,
+                                             double p);
+
+  std::map<std::string, Histogram, std::less<>> histograms_;
+};
+
+}  // namespace internal
+
+using internal::ReplayLatencies;
+
+}  // namespace _replay_latencies
+}  // namespace journal
+}  // namespace principia
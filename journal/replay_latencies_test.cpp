@@ -0,0 +1,90 @@
+#include "journal/replay_latencies.hpp"
+
+#include <chrono>
+#include <string>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace principia {
+namespace journal {
+
+using ::testing::AllOf;
+using ::testing::ElementsAre;
+using ::testing::Field;
+using ::testing::Ge;
+using ::testing::HasSubstr;
+using ::testing::Le;
+using namespace principia::journal::_replay_latencies;
+using namespace std::chrono_literals;
+
+class ReplayLatenciesTest : public ::testing::Test {
+ protected:
+  ReplayLatenciesTest()
+      : test_name_(
+            testing::UnitTest::GetInstance()->current_test_info()->name()) {
+    for (int i = 1; i <= 100; ++i) {
+      latencies_.Record("AdvanceTime", i * 1us);
+    }
+    latencies_.Record("NewPlugin", 1ms);
+  }
+
+  std::string const test_name_;
+  ReplayLatencies latencies_;
+};
+
+TEST_F(ReplayLatenciesTest, Summarize) {
+  // The percentiles are upper bounds within a bucket of the exact values.
+  EXPECT_THAT(
+      latencies_.Summarize(),
+      ElementsAre(
+          AllOf(Field(&ReplayLatencies::Summary::name, "AdvanceTime"),
+                Field(&ReplayLatencies::Summary::count, 100),
+                Field(&ReplayLatencies::Summary::total, 5050us),
+                Field(&ReplayLatencies::Summary::p50,
+                      AllOf(Ge(50us), Le(55us))),
+                Field(&ReplayLatencies::Summary::p99,
+                      AllOf(Ge(99us), Le(100us))),
+                Field(&ReplayLatencies::Summary::max, 100us)),
+          AllOf(Field(&ReplayLatencies::Summary::name, "NewPlugin"),
+                Field(&ReplayLatencies::Summary::count, 1),
+                Field(&ReplayLatencies::Summary::p50, 1ms),
+                Field(&ReplayLatencies::Summary::max, 1ms))));
+}
+
+TEST_F(ReplayLatenciesTest, File) {
+  latencies_.WriteToFile(test_name_ + ".latencies.txt");
+  auto const latencies =
+      ReplayLatencies::ReadFromFile(test_name_ + ".latencies.txt");
+  auto const expected = latencies_.Summarize();
+  auto const actual = latencies.Summarize();
+  ASSERT_EQ(expected.size(), actual.size());
+  for (int i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(expected[i].name, actual[i].name);
+    EXPECT_EQ(expected[i].count, actual[i].count);
+    EXPECT_EQ(expected[i].total, actual[i].total);
+    EXPECT_EQ(expected[i].p50, actual[i].p50);
+    EXPECT_EQ(expected[i].p99, actual[i].p99);
+    EXPECT_EQ(expected[i].max, actual[i].max);
+  }
+}
+
+TEST_F(ReplayLatenciesTest, Compare) {
+  ReplayLatencies candidate;
+  for (int i = 1; i <= 100; ++i) {
+    candidate.Record("AdvanceTime", i * 2us);
+  }
+  candidate.Record("DeletePlugin", 1ms);
+  std::string const comparison =
+      ReplayLatencies::Compare(latencies_, candidate);
+  EXPECT_THAT(comparison,
+              AllOf(HasSubstr("AdvanceTime"),
+                    HasSubstr("2.000"),
+                    HasSubstr("NewPlugin"),
+                    HasSubstr("only in the baseline"),
+                    HasSubstr("DeletePlugin"),
+                    HasSubstr("only in the candidate")));
+}
+
+}  // namespace journal
+}  // namespace principia
@@ -1,8 +1,11 @@
 #include "ksp_plugin/flight_plan.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <iterator>
 #include <memory>
+#include <optional>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -285,6 +288,10 @@ FlightPlan::GetAllSegmentsAvoidingDeadlines() {
   return GetAllSegments();
 }
 
+std::int64_t FlightPlan::generation() const {
+  return generation_;
+}
+
 OrbitAnalyser::Analysis* FlightPlan::analysis(int coast_index) {
   if (coast_index > manœuvres_.size() - number_of_anomalous_manœuvres()) {
     // If the coast follows an anomalous manœuvre, no valid initial state was
@@ -501,11 +508,14 @@ absl::Status FlightPlan::CoastSegment(
     ephemeris_->AwaitReanimation(starting_time);
   }
 
+  auto adaptive_step_parameters = adaptive_step_parameters_;
+  adaptive_step_parameters.set_first_time_step(
+      CoastFirstTimeStep(starting_time));
   return ephemeris_->FlowWithAdaptiveStep(
                          &trajectory_,
                          Ephemeris<Barycentric>::NoIntrinsicAcceleration,
                          desired_final_time,
-                         adaptive_step_parameters_,
+                         adaptive_step_parameters,
                          max_ephemeris_steps);
 }
 
@@ -514,6 +524,7 @@ absl::Status FlightPlan::ComputeSegments(
     std::vector<NavigationManœuvre>::iterator const end,
     std::int64_t const max_ephemeris_steps) {
   CHECK(!segments_.empty());
+  generation_ = NewGeneration();
   if (anomalous_segments_ == 0) {
     anomalous_status_ = absl::OkStatus();
   }
@@ -584,6 +595,7 @@ absl::Status FlightPlan::ComputeSegments(
       anomalous_status_ = status;
     }
   }
+  coast_first_time_steps_.clear();
   return overall_status;
 }
 
@@ -595,6 +607,8 @@ void FlightPlan::AddLastSegment() {
 }
 
 void FlightPlan::ResetLastSegment() {
+  generation_ = NewGeneration();
+  RecordLastCoastFirstTimeStep();
   auto const& last_segment = segments_.back();
   trajectory_.ForgetAfter(std::next(last_segment->begin()));
   if (anomalous_segments_ == 1) {
@@ -603,6 +617,8 @@ void FlightPlan::ResetLastSegment() {
 }
 
 void FlightPlan::PopLastSegment() {
+  generation_ = NewGeneration();
+  RecordLastCoastFirstTimeStep();
   auto& last_segment = segments_.back();
   trajectory_.DeleteSegments(last_segment);
   segments_.pop_back();
@@ -621,6 +637,35 @@ void FlightPlan::PopSegmentsAffectedByManœuvre(int const index) {
   ResetLastSegment();
 }
 
+void FlightPlan::RecordLastCoastFirstTimeStep() {
+  // The segments at even indices are coasts.  A segment starts with a copy of
+  // the last point of the previous one, so its first interval is the first
+  // step of the integrator.
+  if (segments_.size() % 2 == 0) {
+    return;
+  }
+  auto const& last_segment = segments_.back();
+  if (last_segment->size() < 2) {
+    return;
+  }
+  auto const first = last_segment->begin();
+  coast_first_time_steps_[first->time] = std::next(first)->time - first->time;
+}
+
+std::optional<Time> FlightPlan::CoastFirstTimeStep(Instant const& t) const {
+  if (coast_first_time_steps_.empty()) {
+    return std::nullopt;
+  }
+  auto const it = coast_first_time_steps_.lower_bound(t);
+  if (it == coast_first_time_steps_.end()) {
+    return std::prev(it)->second;
+  } else if (it == coast_first_time_steps_.begin()) {
+    return it->second;
+  }
+  auto const previous = std::prev(it);
+  return t - previous->first < it->first - t ? previous->second : it->second;
+}
+
 void FlightPlan::UpdateInitialMassOfManœuvresAfter(int const index) {
   if (index >= manœuvres_.size()) {
     return;
@@ -665,6 +710,11 @@ void FlightPlan::MakeProlongator(Instant const& prolongation_time) {
   }
 }
 
+std::int64_t FlightPlan::NewGeneration() {
+  static std::atomic_int64_t last_generation = 0;
+  return ++last_generation;
+}
+
 Instant FlightPlan::start_of_last_coast() const {
   return manœuvres_.empty() ? initial_time_ : manœuvres_.back().final_time();
 }
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <cstdint>
+#include <map>
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include "absl/status/status.h"
@@ -135,6 +137,11 @@ class FlightPlan {
   virtual DiscreteTrajectory<Barycentric> const&
   GetAllSegmentsAvoidingDeadlines();
 
+  // A number that changes whenever the segments of this flight plan change.
+  // It is never reused, even across flight plans, so it may be used (together
+  // with the address of the flight plan) to invalidate caches of the segments.
+  virtual std::int64_t generation() const;
+
   // Orbit analysis is enabled at construction, and may be enabled/disabled
   // dynamically.
   void EnableAnalysis(bool enabled);
@@ -211,6 +218,14 @@ class FlightPlan {
   // anomalous trajectories, their number is decremented and may become 0.
   void PopLastSegment();
 
+  // If the last segment is a coast, records its first step in
+  // |coast_first_time_steps_|.  Called before the segment is deleted or reset.
+  void RecordLastCoastFirstTimeStep();
+
+  // Returns the first step of the recorded coast that started closest to |t|,
+  // if any.
+  std::optional<Time> CoastFirstTimeStep(Instant const& t) const;
+
   // Pops the burn of the manœuvre with the given index and all following
   // segments, then resets the last segment (which is the coast preceding
   // |manœuvres_[index]|).
@@ -224,6 +239,9 @@ class FlightPlan {
   // Starts a thread to prolong the ephemeris if needed.
   void MakeProlongator(Instant const& prolongation_time);
 
+  // Returns a value that has never been returned before.
+  static std::int64_t NewGeneration();
+
   Instant start_of_last_coast() const;
 
   // In the following functions, |index| refers to the index of a manœuvre.
@@ -251,6 +269,13 @@ class FlightPlan {
   // The status of the first anomalous segment.  Set and used exclusively by
   // |ComputeSegments|.
   absl::Status anomalous_status_;
+  // Updated by the functions that change |segments_|.
+  std::int64_t generation_ = NewGeneration();
+  // The first steps of the coasts discarded by |PopLastSegment| and
+  // |ResetLastSegment|, indexed by the start time of the coast.  Used to seed
+  // the step size control of the coasts recomputed by |ComputeSegments|, which
+  // then clears this map.
+  std::map<Instant, Time> coast_first_time_steps_;
 
   std::vector<NavigationManœuvre> manœuvres_;
 
@@ -0,0 +1,58 @@
+#include "ksp_plugin/indexed_coast_cache.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "base/not_null.hpp"
+
+namespace principia {
+namespace ksp_plugin {
+namespace _indexed_coast_cache {
+namespace internal {
+
+using namespace principia::base::_not_null;
+
+std::shared_ptr<IndexedCoast const> IndexedCoastCache::Get(
+    FlightPlan const& flight_plan,
+    int const segment_index,
+    int const central_body_index,
+    NavigationFrame const& body_centred_inertial) {
+  absl::MutexLock l(&lock_);
+  Key const key{&flight_plan, segment_index, central_body_index};
+  if (auto const it = entries_.find(key);
+      it != entries_.end() &&
+      it->second.generation == flight_plan.generation()) {
+    return it->second.coast;
+  }
+
+  auto coast = std::make_shared<IndexedCoast>();
+  for (auto const& [time, degrees_of_freedom] :
+       *flight_plan.GetSegment(segment_index)) {
+    auto const navigation_degrees_of_freedom =
+        body_centred_inertial.ToThisFrameAtTime(time)(degrees_of_freedom);
+    coast->trajectory.Append(time, navigation_degrees_of_freedom)
+        .IgnoreError();
+    coast->times.push_back(time);
+    coast->positions.push_back(navigation_degrees_of_freedom.position());
+  }
+  std::vector<not_null<Position<Navigation> const*>> values;
+  values.reserve(coast->positions.size());
+  for (auto const& position : coast->positions) {
+    values.push_back(&position);
+  }
+  coast->tree = std::make_unique<
+      PrincipalComponentPartitioningTree<Position<Navigation>>>(
+      values, max_values_per_cell_);
+
+  if (entries_.size() >= max_entries_) {
+    entries_.clear();
+  }
+  entries_.insert_or_assign(
+      key, Entry{.generation = flight_plan.generation(), .coast = coast});
+  return coast;
+}
+
+}  // namespace internal
+}  // namespace _indexed_coast_cache
+}  // namespace ksp_plugin
+}  // namespace principia
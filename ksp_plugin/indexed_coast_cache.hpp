@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include "absl/synchronization/mutex.h"
+#include "geometry/instant.hpp"
+#include "geometry/space.hpp"
+#include "ksp_plugin/flight_plan.hpp"
+#include "ksp_plugin/frames.hpp"
+#include "numerics/nearest_neighbour.hpp"
+#include "physics/discrete_trajectory.hpp"
+
+namespace principia {
+namespace ksp_plugin {
+namespace _indexed_coast_cache {
+namespace internal {
+
+using namespace principia::geometry::_instant;
+using namespace principia::geometry::_space;
+using namespace principia::ksp_plugin::_flight_plan;
+using namespace principia::ksp_plugin::_frames;
+using namespace principia::numerics::_nearest_neighbour;
+using namespace principia::physics::_discrete_trajectory;
+
+// A coast of a flight plan, in a body-centred non-rotating frame, with a
+// spatial index of its points.
+struct IndexedCoast {
+  DiscreteTrajectory<Navigation> trajectory;
+  // The times and positions of the points of |trajectory|, in the same order.
+  // The |tree| points into |positions|, which must not change once the tree
+  // has been built.
+  std::vector<Instant> times;
+  std::vector<Position<Navigation>> positions;
+  std::unique_ptr<PrincipalComponentPartitioningTree<Position<Navigation>>>
+      tree;
+};
+
+// A cache of the |IndexedCoast|s used by
+// |principia__ExternalGetNearestPlannedCoastDegreesOfFreedom|, which is
+// typically called every frame for the same coasts.  The transformation of the
+// coast to the body-centred frame, which requires evaluating the ephemeris at
+// each point, and the construction of the index are only done when the flight
+// plan changes.  This class is thread-safe.
+class IndexedCoastCache {
+ public:
+  // Returns the coast for the segment with the given |segment_index| of the
+  // |flight_plan| in the |body_centred_inertial| frame of the celestial with
+  // the given |central_body_index|, computing it if needed.
+  std::shared_ptr<IndexedCoast const> Get(
+      FlightPlan const& flight_plan,
+      int segment_index,
+      int central_body_index,
+      NavigationFrame const& body_centred_inertial);
+
+ private:
+  // When there are more entries than this, the cache is flushed.  Entries for
+  // flight plans that no longer exist are never used, so this prevents them
+  // from piling up.
+  static constexpr std::int64_t max_entries_ = 16;
+
+  // The leaves of the tree contain at most that many points.
+  static constexpr std::int64_t max_values_per_cell_ = 8;
+
+  using Key = std::tuple<FlightPlan const*, /*segment_index=*/int,
+                         /*central_body_index=*/int>;
+  struct Entry {
+    std::int64_t generation;
+    std::shared_ptr<IndexedCoast const> coast;
+  };
+
+  absl::Mutex lock_;
+  std::map<Key, Entry> entries_ GUARDED_BY(lock_);
+};
+
+}  // namespace internal
+
+using internal::IndexedCoast;
+using internal::IndexedCoastCache;
+
+}  // namespace _indexed_coast_cache
+}  // namespace ksp_plugin
+}  // namespace principia
@@ -36,11 +36,20 @@ OrbitAnalyserDownsamplingParameters() {
   };
 }
 
+DiscreteTrajectorySegment<Barycentric>::DownsamplingParameters
+DebrisPsychohistoryDownsamplingParameters() {
+  return DiscreteTrajectorySegment<Barycentric>::DownsamplingParameters{
+      .max_dense_intervals = 100,
+      .tolerance = 10 * Metre,
+  };
+}
+
 Ephemeris<Barycentric>::AccuracyParameters
 DefaultEphemerisAccuracyParameters() {
   return Ephemeris<Barycentric>::AccuracyParameters(
       /*fitting_tolerance=*/1 * Milli(Metre),
-      /*geopotential_tolerance*/ 0x1.0p-24);
+      /*geopotential_tolerance*/ 0x1.0p-24,
+      ephemeris_cold_horizon);
 }
 
 Ephemeris<Barycentric>::FixedStepParameters
@@ -63,6 +72,16 @@ DefaultBurnParameters() {
       /*speed_integration_tolerance=*/1 * Metre / Second);
 }
 
+Ephemeris<Barycentric>::FixedStepParameters DefaultDebrisHistoryParameters() {
+  // Symplectic, so that the energy of the orbits doesn't drift over the long
+  // periods of time during which debris is left alone.
+  return Ephemeris<Barycentric>::FixedStepParameters(
+      SymplecticRungeKuttaNyströmIntegrator<
+          BlanesMoan2002SRKN14A,
+          Ephemeris<Barycentric>::NewtonianMotionEquation>(),
+      /*step=*/1 * Minute);
+}
+
 Ephemeris<Barycentric>::FixedStepParameters DefaultHistoryParameters() {
   return Ephemeris<Barycentric>::FixedStepParameters(
       SymmetricLinearMultistepIntegrator<
@@ -3,6 +3,7 @@
 #include "ksp_plugin/frames.hpp"
 #include "physics/discrete_trajectory_segment.hpp"
 #include "physics/ephemeris.hpp"
+#include "quantities/astronomy.hpp"
 #include "quantities/quantities.hpp"
 #include "quantities/si.hpp"
 
@@ -14,6 +15,7 @@ namespace internal {
 using namespace principia::ksp_plugin::_frames;
 using namespace principia::physics::_discrete_trajectory_segment;
 using namespace principia::physics::_ephemeris;
+using namespace principia::quantities::_astronomy;
 using namespace principia::quantities::_quantities;
 using namespace principia::quantities::_si;
 
@@ -27,6 +29,17 @@ DefaultDownsamplingParameters();
 DiscreteTrajectorySegment<Barycentric>::DownsamplingParameters
 OrbitAnalyserDownsamplingParameters();
 
+// Parameters for downsampling the psychohistories of the debris.  These are
+// prolonged at every step of the game, instead of being recomputed from the end
+// of the history, so they would otherwise accumulate one point per step.
+DiscreteTrajectorySegment<Barycentric>::DownsamplingParameters
+DebrisPsychohistoryDownsamplingParameters();
+
+// The polynomials of the trajectories of the celestials that end more than this
+// before the end of the ephemeris are compressed.  The game rarely looks that
+// far back, so they are seldom decompressed.
+constexpr Time ephemeris_cold_horizon = 1 * JulianYear;
+
 // Factories for parameters used to control integration.
 Ephemeris<Barycentric>::AccuracyParameters
 DefaultEphemerisAccuracyParameters();
@@ -34,19 +47,23 @@ Ephemeris<Barycentric>::FixedStepParameters
 DefaultEphemerisFixedStepParameters();
 Ephemeris<Barycentric>::GeneralizedAdaptiveStepParameters
 DefaultBurnParameters();
+Ephemeris<Barycentric>::FixedStepParameters DefaultDebrisHistoryParameters();
 Ephemeris<Barycentric>::FixedStepParameters DefaultHistoryParameters();
 Ephemeris<Barycentric>::AdaptiveStepParameters DefaultPredictionParameters();
 Ephemeris<Barycentric>::AdaptiveStepParameters DefaultPsychohistoryParameters();
 
 }  // namespace internal
 
+using internal::DebrisPsychohistoryDownsamplingParameters;
 using internal::DefaultBurnParameters;
+using internal::DefaultDebrisHistoryParameters;
 using internal::DefaultDownsamplingParameters;
 using internal::DefaultEphemerisAccuracyParameters;
 using internal::DefaultEphemerisFixedStepParameters;
 using internal::DefaultHistoryParameters;
 using internal::DefaultPredictionParameters;
 using internal::DefaultPsychohistoryParameters;
+using internal::ephemeris_cold_horizon;
 using internal::OrbitAnalyserDownsamplingParameters;
 
 }  // namespace _integrators
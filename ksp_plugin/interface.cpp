@@ -50,6 +50,7 @@
 #include "journal/recorder.hpp"
 #include "ksp_plugin/frames.hpp"
 #include "ksp_plugin/identification.hpp"
+#include "ksp_plugin/integrators.hpp"
 #include "ksp_plugin/iterators.hpp"
 #include "ksp_plugin/part.hpp"
 #include "physics/degrees_of_freedom.hpp"
@@ -106,6 +107,7 @@ using namespace principia::journal::_method;
 using namespace principia::journal::_recorder;
 using namespace principia::ksp_plugin::_frames;
 using namespace principia::ksp_plugin::_identification;
+using namespace principia::ksp_plugin::_integrators;
 using namespace principia::ksp_plugin::_iterators;
 using namespace principia::ksp_plugin::_part;
 using namespace principia::physics::_degrees_of_freedom;
@@ -135,7 +137,9 @@ constexpr char base64_encoder[] = "base64";
 constexpr char hexadecimal_encoder[] = "hexadecimal";
 
 constexpr int chunk_size = 64 << 10;
-constexpr int number_of_chunks = 8;
+constexpr int number_of_chunks = 16;
+// The number of threads that compress or decompress chunks in parallel.
+constexpr int number_of_compressors = 4;
 
 not_null<Arena*> arena = []() {
   ArenaOptions options;
@@ -148,7 +152,8 @@ Ephemeris<Barycentric>::AccuracyParameters MakeAccuracyParameters(
     ConfigurationAccuracyParameters const& parameters) {
   return Ephemeris<Barycentric>::AccuracyParameters(
       ParseQuantity<Length>(parameters.fitting_tolerance),
-      ParseQuantity<double>(parameters.geopotential_tolerance));
+      ParseQuantity<double>(parameters.geopotential_tolerance),
+      ephemeris_cold_horizon);
 }
 
 Ephemeris<Barycentric>::AdaptiveStepParameters MakeAdaptiveStepParameters(
@@ -555,9 +560,13 @@ void __cdecl principia__DeserializePlugin(
   // Create and start a deserializer if the caller didn't provide one.
   if (*deserializer == nullptr) {
     LOG(INFO) << "Begin plugin deserialization";
-    *deserializer = new PushDeserializer(chunk_size,
-                                         number_of_chunks,
-                                         NewCompressor(compressor));
+    *deserializer = new PushDeserializer(
+        chunk_size,
+        number_of_chunks,
+        /*compressor_factory=*/[compressor]() {
+          return NewCompressor(compressor);
+        },
+        number_of_compressors);
     CHECK_NOTNULL(arena);
     not_null<serialization::Plugin*> const message =
         Arena::CreateMessage<serialization::Plugin>(arena);
@@ -1124,9 +1133,13 @@ char const* __cdecl principia__SerializePlugin(
   // Create and start a serializer if the caller didn't provide one.
   if (*serializer == nullptr) {
     LOG(INFO) << "Begin plugin serialization";
-    *serializer = new PullSerializer(chunk_size,
-                                     number_of_chunks,
-                                     NewCompressor(compressor));
+    *serializer = new PullSerializer(
+        chunk_size,
+        number_of_chunks,
+        /*compressor_factory=*/[compressor]() {
+          return NewCompressor(compressor);
+        },
+        number_of_compressors);
     not_null<serialization::Plugin*> const message =
         Arena::CreateMessage<serialization::Plugin>(arena);
     plugin->WriteToMessage(message);
@@ -176,6 +176,7 @@ Node ToNode(Plugin const& plugin,
 
 QP ToQP(DegreesOfFreedom<World> const& dof);
 QP ToQP(RelativeDegreesOfFreedom<AliceSun> const& relative_dof);
+QP ToQP(RelativeDegreesOfFreedom<World> const& relative_dof);
 
 // Ownership of the status and its message is transferred to the caller.
 Status* ToNewStatus(absl::Status const& status);
@@ -508,6 +508,10 @@ inline QP ToQP(RelativeDegreesOfFreedom<AliceSun> const& relative_dof) {
   return QPConverter<RelativeDegreesOfFreedom<AliceSun>>::ToQP(relative_dof);
 }
 
+inline QP ToQP(RelativeDegreesOfFreedom<World> const& relative_dof) {
+  return QPConverter<RelativeDegreesOfFreedom<World>>::ToQP(relative_dof);
+}
+
 inline Status* ToNewStatus(absl::Status const& status) {
   if (status.ok()) {
     return new Status{static_cast<int>(status.code()),
@@ -1,7 +1,12 @@
 #include "ksp_plugin/interface.hpp"
 
+#include <cstdint>
+#include <iterator>
 #include <limits>
+#include <sstream>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
@@ -43,6 +48,80 @@ Status* OK() {
   return ok;
 }
 
+// The implementation of |principia__ExternalFlowFreefall| and
+// |principia__ExternalFlowFreefalls|.
+// |world_body_centred_initial_degrees_of_freedom| is null-terminated.  Sets
+// the first |final_count| elements of
+// |world_body_centred_final_degrees_of_freedom| to the results.
+absl::Status FlowFreefalls(
+    Plugin const* const plugin,
+    int const central_body_index,
+    double const t_initial,
+    double const t_final,
+    QP const* const* const world_body_centred_initial_degrees_of_freedom,
+    QP* const world_body_centred_final_degrees_of_freedom,
+    int const final_size,
+    int& final_count) {
+  final_count = 0;
+  if (plugin == nullptr) {
+    return absl::InvalidArgumentError("|plugin| must not be null");
+  }
+  if (!plugin->HasCelestial(central_body_index)) {
+    return absl::NotFoundError(
+        absl::StrCat("No celestial with index ", central_body_index));
+  }
+  int size = 0;
+  if (world_body_centred_initial_degrees_of_freedom != nullptr) {
+    while (world_body_centred_initial_degrees_of_freedom[size] != nullptr) {
+      ++size;
+    }
+  }
+  if (final_size < size) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("Final size ", final_size,
+                     " is smaller than initial size ", size));
+  }
+  if (size > 0 && world_body_centred_final_degrees_of_freedom == nullptr) {
+    return absl::InvalidArgumentError(
+        "|world_body_centred_final_degrees_of_freedom| must not be null");
+  }
+  Instant const t0 = FromGameTime(*plugin, t_initial);
+  Instant const t1 = FromGameTime(*plugin, t_final);
+  if (t1 < t0) {
+    return absl::InvalidArgumentError(
+        (std::stringstream{}
+         << "|t_final| " << t1 << " is before |t_initial| " << t0).str());
+  }
+
+  // The |World| degrees of freedom are body-centred inertial, so they only
+  // differ from the |Barycentric| ones relative to the central body by an
+  // orthogonal map.
+  OrthogonalMap<World, Barycentric> const world_to_barycentric =
+      plugin->renderer().WorldToBarycentric(plugin->PlanetariumRotation());
+  std::vector<RelativeDegreesOfFreedom<Barycentric>> initial_degrees_of_freedom;
+  initial_degrees_of_freedom.reserve(size);
+  for (int i = 0; i < size; ++i) {
+    initial_degrees_of_freedom.push_back(
+        world_to_barycentric(FromQP<RelativeDegreesOfFreedom<World>>(
+            *world_body_centred_initial_degrees_of_freedom[i])));
+  }
+
+  auto const final_degrees_of_freedom = plugin->FlowFreefall(
+      central_body_index, initial_degrees_of_freedom, t0, t1);
+  for (auto const& degrees_of_freedom : final_degrees_of_freedom) {
+    if (!degrees_of_freedom.ok()) {
+      return absl::Status(
+          degrees_of_freedom.status().code(),
+          absl::StrCat("Free fall ", final_count, " failed: ",
+                       degrees_of_freedom.status().message()));
+    }
+    world_body_centred_final_degrees_of_freedom[final_count] =
+        ToQP(world_to_barycentric.Inverse()(degrees_of_freedom.value()));
+    ++final_count;
+  }
+  return absl::OkStatus();
+}
+
 }  // namespace
 
 Status* __cdecl principia__ExternalCelestialGetPosition(
@@ -150,12 +229,49 @@ Status* __cdecl principia__ExternalFlowFreefall(
        t_initial,
        t_final},
       {world_body_centred_final_degrees_of_freedom}};
-  if (plugin == nullptr) {
-    return m.Return(
-        ToNewStatus(absl::InvalidArgumentError("|plugin| must not be null")));
-  }
-  return m.Return(ToNewStatus(absl::UnimplementedError(
-      "|ExternalFlowFreefall| is not yet implemented")));
+  QP const* const initial_degrees_of_freedom[] = {
+      &world_body_centred_initial_degrees_of_freedom, nullptr};
+  int final_count;
+  absl::Status const status =
+      FlowFreefalls(plugin,
+                    central_body_index,
+                    t_initial,
+                    t_final,
+                    initial_degrees_of_freedom,
+                    world_body_centred_final_degrees_of_freedom,
+                    /*final_size=*/1,
+                    final_count);
+  return m.Return(status.ok() ? OK() : ToNewStatus(status));
+}
+
+Status* __cdecl principia__ExternalFlowFreefalls(
+    Plugin const* const plugin,
+    int const central_body_index,
+    double const t_initial,
+    double const t_final,
+    QP const* const* const world_body_centred_initial_degrees_of_freedom,
+    QP* const world_body_centred_final_degrees_of_freedom,
+    int const world_body_centred_final_degrees_of_freedom_size,
+    int* const final_count) {
+  journal::Method<journal::ExternalFlowFreefalls> m{
+      {plugin,
+       central_body_index,
+       t_initial,
+       t_final,
+       world_body_centred_initial_degrees_of_freedom,
+       world_body_centred_final_degrees_of_freedom,
+       world_body_centred_final_degrees_of_freedom_size},
+      {final_count}};
+  absl::Status const status =
+      FlowFreefalls(plugin,
+                    central_body_index,
+                    t_initial,
+                    t_final,
+                    world_body_centred_initial_degrees_of_freedom,
+                    world_body_centred_final_degrees_of_freedom,
+                    world_body_centred_final_degrees_of_freedom_size,
+                    *final_count);
+  return m.Return(status.ok() ? OK() : ToNewStatus(status));
 }
 
 Status* __cdecl principia__ExternalGeopotentialGetCoefficient(
@@ -289,14 +405,12 @@ Status* __cdecl principia__ExternalGetNearestPlannedCoastDegreesOfFreedom(
   }
   auto const body_centred_inertial =
       plugin->NewBodyCentredNonRotatingNavigationFrame(central_body_index);
-  DiscreteTrajectory<Navigation> coast;
-  for (auto const& [time, degrees_of_freedom] :
-       *flight_plan.GetSegment(segment_index)) {
-    coast.Append(
-        time,
-        body_centred_inertial->ToThisFrameAtTime(time)(degrees_of_freedom))
-        .IgnoreError();
-  }
+  auto const indexed_coast =
+      plugin->indexed_coast_cache().Get(flight_plan,
+                                        segment_index,
+                                        central_body_index,
+                                        *body_centred_inertial);
+  auto const& coast = indexed_coast->trajectory;
 
   Instant const current_time = plugin->CurrentTime();
   // The given |World| position and requested |World| degrees of freedom are
@@ -328,15 +442,44 @@ Status* __cdecl principia__ExternalGetNearestPlannedCoastDegreesOfFreedom(
         coast.back().time,
         {reference_position, Navigation::unmoving}).IgnoreError();
   }
-  DiscreteTrajectory<Navigation> apoapsides;
-  DiscreteTrajectory<Navigation> periapsides;
-  ComputeApsides(/*reference=*/immobile_reference,
-                 coast,
-                 coast.begin(), coast.end(),
-                 /*t_max=*/InfiniteFuture,
-                 /*max_points=*/std::numeric_limits<int>::max(),
-                 apoapsides,
-                 periapsides);
+
+  // The first local minimum of the distance is at or before its global
+  // minimum, so we only need to look for periapsides up to the point following
+  // the nearest point, which the index gives us in logarithmic time.  If the
+  // nearest point is an endpoint, there may be earlier local minima anywhere,
+  // so we look at the entire coast.
+  // Note that the search always starts at the beginning of the coast, so it is
+  // linear in the position of the nearest point, not logarithmic in the size
+  // of the coast.  In the worst case (the nearest point is an endpoint, or the
+  // distance is flat near it) the entire coast is scanned, in O(n).
+  std::int64_t const nearest_index =
+      indexed_coast->tree->FindNearestNeighbour(reference_position) -
+      indexed_coast->positions.data();
+  std::int64_t const last_index = indexed_coast->positions.size() - 1;
+  auto const end_of_search =
+      nearest_index == 0 || nearest_index == last_index
+          ? coast.end()
+          : std::next(coast.find(indexed_coast->times[nearest_index + 1]));
+  auto const compute_periapsides =
+      [&coast, &immobile_reference](
+          DiscreteTrajectory<Navigation>::iterator const end) {
+        DiscreteTrajectory<Navigation> apoapsides;
+        DiscreteTrajectory<Navigation> periapsides;
+        ComputeApsides(/*reference=*/immobile_reference,
+                       coast,
+                       coast.begin(), end,
+                       /*t_max=*/InfiniteFuture,
+                       /*max_points=*/1,
+                       apoapsides,
+                       periapsides);
+        return periapsides;
+      };
+  DiscreteTrajectory<Navigation> periapsides =
+      compute_periapsides(end_of_search);
+  if (periapsides.empty() && end_of_search != coast.end()) {
+    // This may happen if the distance is flat near the nearest point.
+    periapsides = compute_periapsides(coast.end());
+  }
   if (periapsides.empty()) {
     bool const begin_is_nearest =
         (coast.front().degrees_of_freedom.position() -
@@ -3,15 +3,18 @@
 #include <algorithm>
 #include <array>
 #include <chrono>
+#include <fstream>
 #include <string>
 #include <type_traits>
 
+#include "base/profiler.hpp"
 #include "quantities/quantities.hpp"
 #include "quantities/si.hpp"
 
 namespace principia {
 namespace interface {
 
+using namespace principia::base::_profiler;
 using namespace principia::quantities::_quantities;
 using namespace principia::quantities::_si;
 
@@ -59,9 +62,13 @@ void __cdecl principia__MonitorStop(int const i) {
   Monitor& monitor = monitors[i];
   if (monitor.is_running) {
     monitor.is_running = false;
+    auto const stop_time = std::chrono::steady_clock::now();
+    Profiler::Record(
+        monitor.name == nullptr ? "Monitor" : monitor.name->c_str(),
+        monitor.start_time,
+        stop_time);
     auto const Δt =
-        std::chrono::nanoseconds(
-            std::chrono::steady_clock::now() - monitor.start_time).count() *
+        std::chrono::nanoseconds(stop_time - monitor.start_time).count() *
         Nano(Second);
     monitor.min_Δt = std::min(monitor.min_Δt, Δt);
     monitor.max_Δt = std::max(monitor.max_Δt, Δt);
@@ -79,5 +86,28 @@ void __cdecl principia__MonitorStop(int const i) {
   }
 }
 
+void __cdecl principia__MonitorSetProfilerEnabled(bool const enabled) {
+  LOG(INFO) << (enabled ? "Enabling" : "Disabling") << " the profiler";
+  Profiler::Enable(enabled);
+}
+
+// Logs the latency statistics of the profiled scopes, writes the trace to
+// |filename| in the Chrome trace event format, and discards the recorded
+// events.
+void __cdecl principia__MonitorWriteProfile(char const* const filename) {
+  for (auto const& statistics : Profiler::ComputeStatistics()) {
+    LOG(INFO) << "[Profiler: " << statistics.name
+              << "] count = " << statistics.count
+              << ", p50 = " << statistics.p50.count() * Nano(Second)
+              << ", p99 = " << statistics.p99.count() * Nano(Second)
+              << ", max = " << statistics.max.count() * Nano(Second);
+  }
+  std::ofstream trace(filename);
+  Profiler::WriteChromeTrace(trace);
+  LOG_IF(ERROR, !trace.good()) << "Could not write the profile to "
+                               << filename;
+  Profiler::Clear();
+}
+
 }  // namespace interface
 }  // namespace principia
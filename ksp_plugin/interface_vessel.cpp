@@ -1,6 +1,8 @@
 #include "ksp_plugin/interface.hpp"
 
+#include <cstdint>
 #include <numeric>
+#include <optional>
 #include <string>
 
 #include "geometry/grassmann.hpp"
@@ -34,6 +36,16 @@ XYZ __cdecl principia__VesselBinormal(Plugin const* const plugin,
   return m.Return(ToXYZ(plugin->VesselBinormal(vessel_guid)));
 }
 
+void __cdecl principia__VesselClearPredictionLevelOfDetail(
+    Plugin const* const plugin,
+    char const* const vessel_guid) {
+  journal::Method<journal::VesselClearPredictionLevelOfDetail> m(
+      {plugin, vessel_guid});
+  CHECK_NOTNULL(plugin);
+  plugin->GetVessel(vessel_guid)->set_prediction_level_of_detail(std::nullopt);
+  return m.Return();
+}
+
 // Calls |plugin->VesselFromParent| with the arguments given.
 // |plugin| must not be null.  No transfer of ownership.
 QP __cdecl principia__VesselFromParent(Plugin const* const plugin,
@@ -99,6 +111,15 @@ void __cdecl principia__VesselRequestAnalysis(Plugin* const plugin,
   return m.Return();
 }
 
+void __cdecl principia__VesselSetDebris(Plugin const* const plugin,
+                                        char const* const vessel_guid,
+                                        bool const debris) {
+  journal::Method<journal::VesselSetDebris> m({plugin, vessel_guid, debris});
+  CHECK_NOTNULL(plugin);
+  plugin->GetVessel(vessel_guid)->set_debris(debris);
+  return m.Return();
+}
+
 void __cdecl principia__VesselSetPredictionAdaptiveStepParameters(
     Plugin const* const plugin,
     char const* const vessel_guid,
@@ -111,6 +132,32 @@ void __cdecl principia__VesselSetPredictionAdaptiveStepParameters(
   return m.Return();
 }
 
+// The durations are in seconds and the tolerances in metres.
+void __cdecl principia__VesselSetPredictionLevelOfDetail(
+    Plugin const* const plugin,
+    char const* const vessel_guid,
+    double const full_accuracy_duration,
+    double const tolerance_multiplier,
+    std::int64_t const max_dense_intervals,
+    double const downsampling_tolerance) {
+  journal::Method<journal::VesselSetPredictionLevelOfDetail> m(
+      {plugin,
+       vessel_guid,
+       full_accuracy_duration,
+       tolerance_multiplier,
+       max_dense_intervals,
+       downsampling_tolerance});
+  CHECK_NOTNULL(plugin);
+  plugin->GetVessel(vessel_guid)->set_prediction_level_of_detail(
+      Vessel::PredictionLevelOfDetail{
+          .full_accuracy_duration = full_accuracy_duration * Second,
+          .tolerance_multiplier = tolerance_multiplier,
+          .downsampling_parameters = {
+              .max_dense_intervals = max_dense_intervals,
+              .tolerance = downsampling_tolerance * Metre}});
+  return m.Return();
+}
+
 XYZ __cdecl principia__VesselTangent(Plugin const* const plugin,
                                      char const* const vessel_guid) {
   journal::Method<journal::VesselTangent> m({plugin, vessel_guid});
@@ -1,6 +1,8 @@
 #include "ksp_plugin/pile_up.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <functional>
 #include <iterator>
 #include <list>
@@ -55,6 +57,11 @@ const auto part_x = Vector<double, RigidPart>({1, 0, 0});
 const auto part_y = Vector<double, RigidPart>({0, 1, 0});
 const auto part_z = Vector<double, RigidPart>({0, 0, 1});
 
+// The number of parts updated by a single task when the parts of a pile-up are
+// updated in parallel.  Most pile-ups have fewer parts than this and are
+// updated by the calling thread alone.
+constexpr std::int64_t parts_per_chunk = 32;
+
 PileUp::PileUp(
     std::list<not_null<Part*>> parts,
     Instant const& t,
@@ -118,17 +125,125 @@ void PileUp::SetPartApparentRigidMotion(
                   << rigid_motion;
 }
 
-absl::Status PileUp::DeformAndAdvanceTime(Instant const& t) {
+absl::Status PileUp::DeformAndAdvanceTime(
+    Instant const& t,
+    ThreadPool<absl::Status>* const thread_pool) {
   absl::MutexLock l(lock_.get());
   absl::Status status;
   if (psychohistory_->back().time < t) {
     DeformPileUpIfNeeded(t);
-    status = AdvanceTime(t);
-    NudgeParts();
+    status = AdvanceTime(t, thread_pool);
+    NudgeParts(thread_pool);
   }
   return status;
 }
 
+void PileUp::PrecomputeMotions(std::vector<not_null<PileUp*>> const& pile_ups,
+                               Instant const& t) {
+  std::vector<not_null<PileUp*>> propagated_pile_ups;
+  std::vector<not_null<EulerSolver<NonRotatingPileUp,
+                                   PileUpPrincipalAxes> const*>> euler_solvers;
+  for (not_null<PileUp*> const pile_up : pile_ups) {
+    absl::MutexLock l(pile_up->lock_.get());
+    if (pile_up->psychohistory_->back().time < t &&
+        pile_up->apparent_part_rigid_motion_.empty()) {
+      propagated_pile_ups.push_back(pile_up);
+      euler_solvers.push_back(&*pile_up->euler_solver_);
+    }
+  }
+
+  std::vector<DegreesOfFreedom<NonRotatingPileUp>> const linear_motions(
+      euler_solvers.size(),
+      DegreesOfFreedom<NonRotatingPileUp>(NonRotatingPileUp::origin,
+                                          NonRotatingPileUp::unmoving));
+  auto const motions =
+      EulerSolver<NonRotatingPileUp, PileUpPrincipalAxes>::MotionsAt(
+          euler_solvers, t, linear_motions);
+
+  for (std::int64_t i = 0; i < propagated_pile_ups.size(); ++i) {
+    PileUp& pile_up = *propagated_pile_ups[i];
+    absl::MutexLock l(pile_up.lock_.get());
+    pile_up.precomputed_motion_.emplace(t, motions[i]);
+  }
+}
+
+void PileUp::AdvanceHistoriesInBulk(
+    std::vector<not_null<PileUp*>> const& pile_ups,
+    Instant const& t,
+    Ephemeris<Barycentric>::FixedStepParameters const& parameters) {
+  std::vector<not_null<PileUp*>> lagging_pile_ups;
+  std::map<Instant, std::int64_t> history_last_counts;
+  for (not_null<PileUp*> const pile_up : pile_ups) {
+    absl::MutexLock l(pile_up->lock_.get());
+    if (pile_up->psychohistory_->back().time < t &&
+        pile_up->intrinsic_force_ == Vector<Force, Barycentric>{}) {
+      lagging_pile_ups.push_back(pile_up);
+      ++history_last_counts[pile_up->history_->back().time];
+    }
+  }
+  if (lagging_pile_ups.empty()) {
+    return;
+  }
+
+  // The ensemble starts where most of the histories end.  Ties are broken in
+  // favour of the latest time so that, on the first call, all the pile-ups may
+  // join.
+  auto ensemble_it = history_last_counts.cbegin();
+  for (auto it = history_last_counts.cbegin();
+       it != history_last_counts.cend();
+       ++it) {
+    if (it->second >= ensemble_it->second) {
+      ensemble_it = it;
+    }
+  }
+  Instant const ensemble_time = ensemble_it->first;
+
+  // The pile-ups whose histories end before the ensemble catch up with it using
+  // their adaptive step parameters.
+  std::vector<not_null<PileUp*>> ensemble;
+  std::vector<not_null<DiscreteTrajectory<Barycentric>*>> trajectories;
+  for (not_null<PileUp*> const pile_up : lagging_pile_ups) {
+    absl::MutexLock l(pile_up->lock_.get());
+    auto const& [history_last_time, history_last_degrees_of_freedom] =
+        pile_up->history_->back();
+    if (history_last_time > ensemble_time) {
+      continue;
+    }
+    auto& bulk_history = pile_up->bulk_history_.emplace();
+    bulk_history.Append(history_last_time, history_last_degrees_of_freedom)
+        .IgnoreError();
+    if (history_last_time < ensemble_time) {
+      absl::Status const status = pile_up->ephemeris_->FlowWithAdaptiveStep(
+          &bulk_history,
+          Ephemeris<Barycentric>::NoIntrinsicAcceleration,
+          ensemble_time,
+          pile_up->adaptive_step_parameters_);
+      if (!status.ok() || bulk_history.back().time != ensemble_time) {
+        pile_up->bulk_history_.reset();
+        continue;
+      }
+    }
+    ensemble.push_back(pile_up);
+    trajectories.push_back(&bulk_history);
+  }
+  if (ensemble.empty() || ensemble_time + parameters.step() > t) {
+    return;
+  }
+
+  not_null<Ephemeris<Barycentric>*> const ephemeris =
+      ensemble.front()->ephemeris_;
+  auto const instance = ephemeris->NewInstance(
+      trajectories,
+      Ephemeris<Barycentric>::NoIntrinsicAccelerations,
+      parameters);
+  if (!ephemeris->FlowWithFixedStep(t, *instance).ok()) {
+    for (not_null<PileUp*> const pile_up : ensemble) {
+      absl::MutexLock l(pile_up->lock_.get());
+      pile_up->bulk_history_.reset();
+    }
+  }
+}
+
 void PileUp::RecomputeFromParts() {
   absl::MutexLock l(lock_.get());
   mass_ = Mass();
@@ -439,10 +554,16 @@ void PileUp::MakeEulerSolver(
 }
 
 void PileUp::DeformPileUpIfNeeded(Instant const& t) {
+  // The precomputed motion is only usable by this call.
+  auto const precomputed_motion = std::move(precomputed_motion_);
+  precomputed_motion_.reset();
+
   if (apparent_part_rigid_motion_.empty()) {
     RigidMotion<PileUpPrincipalAxes, NonRotatingPileUp> const pile_up_motion =
-        euler_solver_->MotionAt(
-            t, {NonRotatingPileUp::origin, NonRotatingPileUp::unmoving});
+        precomputed_motion.has_value() && precomputed_motion->first == t
+            ? precomputed_motion->second
+            : euler_solver_->MotionAt(
+                  t, {NonRotatingPileUp::origin, NonRotatingPileUp::unmoving});
 
     for (auto& [part, actual_rigid_motion] : actual_part_rigid_motion_) {
       actual_rigid_motion =
@@ -580,10 +701,36 @@ void PileUp::DeformPileUpIfNeeded(Instant const& t) {
   apparent_part_rigid_motion_.clear();
 }
 
-absl::Status PileUp::AdvanceTime(Instant const& t) {
+absl::Status PileUp::AdvanceTime(Instant const& t,
+                                 ThreadPool<absl::Status>* const thread_pool) {
   absl::Status status;
   Instant const history_last = history_->back().time;
-  if (intrinsic_force_ == Vector<Force, Barycentric>{}) {
+  if (bulk_history_.has_value()) {
+    // The history was advanced by |AdvanceHistoriesInBulk|, so the
+    // |fixed_instance_|, if any, is stale.
+    fixed_instance_ = nullptr;
+    if (bulk_history_->size() > 1) {
+      // Remove the fork and append the new points of the history.  Note how we
+      // skip the first point, which is already present in the |trajectory_|.
+      trajectory_.DeleteSegments(psychohistory_);
+      for (auto it = std::next(bulk_history_->begin());
+           it != bulk_history_->end();
+           ++it) {
+        trajectory_.Append(it->time, it->degrees_of_freedom).IgnoreError();
+      }
+      psychohistory_ = trajectory_.NewSegment();
+      psychohistory_->SetDownsampling(
+          DebrisPsychohistoryDownsamplingParameters());
+    }
+    bulk_history_.reset();
+    // The history steps are long, so instead of recomputing the psychohistory
+    // from the end of the history we prolong it.
+    status = ephemeris_->FlowWithAdaptiveStep(
+        &trajectory_,
+        Ephemeris<Barycentric>::NoIntrinsicAcceleration,
+        t,
+        adaptive_step_parameters_);
+  } else if (intrinsic_force_ == Vector<Force, Barycentric>{}) {
     // Remove the fork.
     trajectory_.DeleteSegments(psychohistory_);
     if (fixed_instance_ == nullptr) {
@@ -633,22 +780,16 @@ absl::Status PileUp::AdvanceTime(Instant const& t) {
   // Append the |history_| to the parts' history and the |psychohistory_| to the
   // parts' psychohistory.  Drop the history of the pile-up, we won't need it
   // anymore.
-  auto const history_end = history_->end();
-  auto const psychohistory_end = psychohistory_->end();
-  for (auto it = trajectory_.upper_bound(history_last);
-       it != history_end;
-       ++it) {
-    AppendToPart<&Part::AppendToHistory>(it);
-  }
-  for (auto it = history_end; it != psychohistory_end; ++it) {
-    AppendToPart<&Part::AppendToPsychohistory>(it);
-  }
+  AppendToParts(trajectory_.upper_bound(history_last),
+                history_->end(),
+                psychohistory_->end(),
+                thread_pool);
   trajectory_.ForgetBefore(psychohistory_->front().time);
 
   return status;
 }
 
-void PileUp::NudgeParts() const {
+void PileUp::NudgeParts(ThreadPool<absl::Status>* const thread_pool) const {
   auto const actual_centre_of_mass = psychohistory_->back().degrees_of_freedom;
 
   RigidMotion<Barycentric, NonRotatingPileUp> const barycentric_to_pile_up{
@@ -659,32 +800,146 @@ void PileUp::NudgeParts() const {
       Barycentric::nonrotating,
       actual_centre_of_mass.velocity()};
   auto const pile_up_to_barycentric = barycentric_to_pile_up.Inverse();
-  for (not_null<Part*> const part : parts_) {
-    RigidMotion<RigidPart, Barycentric> const actual_part_rigid_motion =
-        pile_up_to_barycentric * FindOrDie(actual_part_rigid_motion_, part);
-    part->set_rigid_motion(actual_part_rigid_motion);
-  }
+  std::vector<not_null<Part*>> const parts(parts_.begin(), parts_.end());
+  ForEachChunkOfParts(
+      parts,
+      [this, &parts, &pile_up_to_barycentric](std::int64_t const chunk_begin,
+                                               std::int64_t const chunk_end) {
+        for (std::int64_t i = chunk_begin; i < chunk_end; ++i) {
+          not_null<Part*> const part = parts[i];
+          RigidMotion<RigidPart, Barycentric> const actual_part_rigid_motion =
+              pile_up_to_barycentric *
+              FindOrDie(actual_part_rigid_motion_, part);
+          part->set_rigid_motion(actual_part_rigid_motion);
+        }
+      },
+      thread_pool);
 }
 
-template<PileUp::AppendToPartTrajectory append_to_part_trajectory>
-void PileUp::AppendToPart(DiscreteTrajectory<Barycentric>::iterator it) const {
-  auto const& pile_up_dof = it->degrees_of_freedom;
-  RigidMotion<Barycentric, NonRotatingPileUp> const barycentric_to_pile_up(
-      RigidTransformation<Barycentric, NonRotatingPileUp>(
-          pile_up_dof.position(),
-          NonRotatingPileUp::origin,
-          OrthogonalMap<Barycentric, NonRotatingPileUp>::Identity()),
-      Barycentric::nonrotating,
-      pile_up_dof.velocity());
-  auto const pile_up_to_barycentric = barycentric_to_pile_up.Inverse();
-  for (not_null<Part*> const part : parts_) {
-    DegreesOfFreedom<NonRotatingPileUp> const actual_part_degrees_of_freedom =
+void PileUp::AppendToParts(
+    DiscreteTrajectory<Barycentric>::iterator const begin,
+    DiscreteTrajectory<Barycentric>::iterator const history_end,
+    DiscreteTrajectory<Barycentric>::iterator const psychohistory_end,
+    ThreadPool<absl::Status>* const thread_pool) const {
+  // The times and motions of the pile-up, stored contiguously and shared by
+  // all the parts.
+  std::vector<Instant> times;
+  std::vector<RigidMotion<NonRotatingPileUp, Barycentric>>
+      pile_up_to_barycentric;
+  std::int64_t history_size = 0;
+  for (auto it = begin; it != psychohistory_end; ++it) {
+    if (it == history_end) {
+      history_size = times.size();
+    }
+    auto const& pile_up_dof = it->degrees_of_freedom;
+    RigidMotion<Barycentric, NonRotatingPileUp> const barycentric_to_pile_up(
+        RigidTransformation<Barycentric, NonRotatingPileUp>(
+            pile_up_dof.position(),
+            NonRotatingPileUp::origin,
+            OrthogonalMap<Barycentric, NonRotatingPileUp>::Identity()),
+        Barycentric::nonrotating,
+        pile_up_dof.velocity());
+    times.push_back(it->time);
+    pile_up_to_barycentric.push_back(barycentric_to_pile_up.Inverse());
+  }
+  if (history_end == psychohistory_end) {
+    history_size = times.size();
+  }
+
+  // Each part is looked up once, and its degrees of freedom in the pile-up are
+  // stored contiguously.
+  std::vector<not_null<Part*>> const parts(parts_.begin(), parts_.end());
+  std::vector<DegreesOfFreedom<NonRotatingPileUp>>
+      actual_parts_degrees_of_freedom;
+  actual_parts_degrees_of_freedom.reserve(parts.size());
+  for (not_null<Part*> const part : parts) {
+    actual_parts_degrees_of_freedom.push_back(
         FindOrDie(actual_part_rigid_motion_, part)({RigidPart::origin,
-                                                    RigidPart::unmoving});
-    (static_cast<Part*>(part)->*append_to_part_trajectory)(
-        it->time,
-        pile_up_to_barycentric(actual_part_degrees_of_freedom));
+                                                    RigidPart::unmoving}));
+  }
+
+  // The trajectory of each part is appended to sequentially, but the parts are
+  // independent from one another.
+  std::int64_t const size = times.size();
+  ForEachChunkOfParts(
+      parts,
+      [&actual_parts_degrees_of_freedom,
+       history_size,
+       &parts,
+       &pile_up_to_barycentric,
+       size,
+       &times](std::int64_t const chunk_begin, std::int64_t const chunk_end) {
+        for (std::int64_t j = chunk_begin; j < chunk_end; ++j) {
+          not_null<Part*> const part = parts[j];
+          auto const& actual_part_degrees_of_freedom =
+              actual_parts_degrees_of_freedom[j];
+          for (std::int64_t i = 0; i < history_size; ++i) {
+            part->AppendToHistory(
+                times[i],
+                pile_up_to_barycentric[i](actual_part_degrees_of_freedom));
+          }
+          for (std::int64_t i = history_size; i < size; ++i) {
+            part->AppendToPsychohistory(
+                times[i],
+                pile_up_to_barycentric[i](actual_part_degrees_of_freedom));
+          }
+        }
+      },
+      thread_pool);
+}
+
+void PileUp::ForEachChunkOfParts(
+    std::vector<not_null<Part*>> const& parts,
+    std::function<void(std::int64_t begin, std::int64_t end)> const&
+        process_parts,
+    ThreadPool<absl::Status>* const thread_pool) {
+  std::int64_t const size = parts.size();
+  std::int64_t const number_of_chunks =
+      (size + parts_per_chunk - 1) / parts_per_chunk;
+  if (thread_pool == nullptr || number_of_chunks <= 1) {
+    process_parts(0, size);
+    return;
+  }
+
+  // The chunks are claimed by whichever thread gets to them first.  The state
+  // is shared with the tasks because they may start after this function has
+  // returned, in which case they find no chunk to claim and never touch
+  // |process_parts|.
+  struct Chunks {
+    std::atomic<std::int64_t> next_chunk = 0;
+    absl::Mutex lock;
+    std::int64_t processed_chunks GUARDED_BY(lock) = 0;
+  };
+  auto const chunks = std::make_shared<Chunks>();
+  auto const process_chunks =
+      [chunks, number_of_chunks, &process_parts, size]() {
+        for (;;) {
+          std::int64_t const chunk = chunks->next_chunk++;
+          if (chunk >= number_of_chunks) {
+            return;
+          }
+          process_parts(chunk * parts_per_chunk,
+                        std::min(size, (chunk + 1) * parts_per_chunk));
+          absl::MutexLock l(&chunks->lock);
+          ++chunks->processed_chunks;
+        }
+      };
+  for (std::int64_t i = 1; i < number_of_chunks; ++i) {
+    thread_pool->Add([process_chunks]() {
+      process_chunks();
+      return absl::OkStatus();
+    });
   }
+  process_chunks();
+
+  // All the chunks have been claimed, wait for those that are being processed
+  // by the tasks.
+  absl::MutexLock l(&chunks->lock);
+  auto const all_chunks_processed = [&chunks, number_of_chunks]() {
+    chunks->lock.AssertReaderHeld();
+    return chunks->processed_chunks == number_of_chunks;
+  };
+  chunks->lock.Await(absl::Condition(&all_chunks_processed));
 }
 
 PileUpFuture::PileUpFuture(not_null<PileUp const*> const pile_up,
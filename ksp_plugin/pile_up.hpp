@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <future>
 #include <list>
@@ -7,10 +8,13 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "absl/status/status.h"
 #include "absl/synchronization/mutex.h"
 #include "base/not_null.hpp"
+#include "base/thread_pool.hpp"
 #include "geometry/frame.hpp"
 #include "geometry/grassmann.hpp"
 #include "geometry/instant.hpp"
@@ -42,6 +46,7 @@ namespace _pile_up {
 namespace internal {
 
 using namespace principia::base::_not_null;
+using namespace principia::base::_thread_pool;
 using namespace principia::geometry::_frame;
 using namespace principia::geometry::_grassmann;
 using namespace principia::geometry::_instant;
@@ -119,8 +124,36 @@ class PileUp {
   // Deforms the pile-up, advances the time, and nudges the parts, in sequence.
   // Does nothing if the psychohistory is already advanced beyond |t|.  Several
   // executions of this method may happen concurrently on multiple threads, but
-  // not concurrently with any other method of this class.
-  absl::Status DeformAndAdvanceTime(Instant const& t);
+  // not concurrently with any other method of this class.  If |thread_pool| is
+  // not null, the parts of large pile-ups are updated in parallel on it; this
+  // method may itself run on |thread_pool|.
+  absl::Status DeformAndAdvanceTime(
+      Instant const& t,
+      ThreadPool<absl::Status>* thread_pool = nullptr);
+
+  // Computes in one pass the motions at |t| of those |pile_ups| that the next
+  // call to |DeformAndAdvanceTime(t)| will propagate using their Euler solver,
+  // i.e., those for which no apparent motion was set.  These motions are then
+  // used by |DeformAndAdvanceTime|.  Several executions of this method may
+  // happen concurrently on disjoint |pile_ups|, but not concurrently with any
+  // other method of the |pile_ups|.
+  static void PrecomputeMotions(std::vector<not_null<PileUp*>> const& pile_ups,
+                                Instant const& t);
+
+  // Advances the histories of those |pile_ups| that lag behind |t| and are in
+  // inertial motion, using a single instance of the fixed-step integrator
+  // given by |parameters|.  The pile-ups join the ensemble at the time where
+  // most of their histories end, which is normally the time reached by the
+  // previous call; those whose histories end later join at a later call.  The
+  // next call to |DeformAndAdvanceTime(t)| for the pile-ups of the ensemble
+  // only prolongs their psychohistories.  If a collision is detected, the
+  // ensemble is abandoned and the pile-ups are advanced individually, so that
+  // the collision is reported for the pile-up that caused it.  Must not be
+  // executed concurrently with any other method of the |pile_ups|.
+  static void AdvanceHistoriesInBulk(
+      std::vector<not_null<PileUp*>> const& pile_ups,
+      Instant const& t,
+      Ephemeris<Barycentric>::FixedStepParameters const& parameters);
 
   // Recomputes the state of motion of the pile-up based on that of its parts.
   void RecomputeFromParts();
@@ -142,11 +175,6 @@ class PileUp {
       std::function<void()> deletion_callback);
 
  private:
-  // A pointer to a member function of |Part| used to append a point to either
-  // trajectory (history or psychohistory).
-  using AppendToPartTrajectory =
-      void (Part::*)(Instant const&, DegreesOfFreedom<Barycentric> const&);
-
   // For deserialization.  The iterators are optional for compatibility with
   // old saves.
   PileUp(
@@ -177,16 +205,35 @@ class PileUp {
   // the histories of the parts and updates the degrees of freedom of the parts
   // if the pile-up is in the bubble.  After this call, the tail (of |*this|)
   // and of its parts have a (possibly ahistorical) final point exactly at |t|.
-  absl::Status AdvanceTime(Instant const& t);
+  absl::Status AdvanceTime(Instant const& t,
+                           ThreadPool<absl::Status>* thread_pool = nullptr);
 
   // Adjusts the degrees of freedom of all parts in this pile up based on the
   // degrees of freedom of the pile-up computed by |AdvanceTime| and on the
   // |NonRotatingPileUp| degrees of freedom of the parts, as set by
   // |DeformPileUpIfNeeded|.
-  void NudgeParts() const;
-
-  template<AppendToPartTrajectory append_to_part_trajectory>
-  void AppendToPart(DiscreteTrajectory<Barycentric>::iterator it) const;
+  void NudgeParts(ThreadPool<absl::Status>* thread_pool = nullptr) const;
+
+  // Appends the points of the pile-up trajectory in [begin, history_end[ to the
+  // histories of the parts, and those in [history_end, psychohistory_end[ to
+  // their psychohistories.  The motions of the pile-up are computed once for
+  // all the parts, and the trajectory of each part is appended to in a single
+  // pass.
+  void AppendToParts(
+      DiscreteTrajectory<Barycentric>::iterator begin,
+      DiscreteTrajectory<Barycentric>::iterator history_end,
+      DiscreteTrajectory<Barycentric>::iterator psychohistory_end,
+      ThreadPool<absl::Status>* thread_pool) const;
+
+  // Calls |process_parts| on consecutive chunks of |parts|.  The chunks are
+  // processed by the calling thread and, if |thread_pool| is not null, by tasks
+  // of |thread_pool|.  The calling thread never waits for a task that has not
+  // started, so this may be called from a task of |thread_pool|.
+  static void ForEachChunkOfParts(
+      std::vector<not_null<Part*>> const& parts,
+      std::function<void(std::int64_t begin, std::int64_t end)> const&
+          process_parts,
+      ThreadPool<absl::Status>* thread_pool);
 
   // Wrapped in a |unique_ptr| to be moveable.
   not_null<std::unique_ptr<absl::Mutex>> lock_;
@@ -237,6 +284,11 @@ class PileUp {
       Ephemeris<Barycentric>::NewtonianMotionEquation>::Instance>
       fixed_instance_;
 
+  // The points computed for the history of this pile-up by
+  // |AdvanceHistoriesInBulk|, starting at the end of the |history_|.  They are
+  // appended to the |history_| by the next call to |AdvanceTime|.
+  std::optional<DiscreteTrajectory<Barycentric>> bulk_history_;
+
   PartTo<RigidMotion<RigidPart, NonRotatingPileUp>> actual_part_rigid_motion_;
   PartTo<RigidMotion<RigidPart, Apparent>> apparent_part_rigid_motion_;
 
@@ -244,6 +296,12 @@ class PileUp {
   std::optional<EulerSolver<NonRotatingPileUp, PileUpPrincipalAxes>>
       euler_solver_;
 
+  // The time and the motion computed by |PrecomputeMotions|, used by the next
+  // call to |DeformPileUpIfNeeded| if it is for that time.
+  std::optional<
+      std::pair<Instant, RigidMotion<PileUpPrincipalAxes, NonRotatingPileUp>>>
+      precomputed_motion_;
+
   // Called in the destructor.
   std::function<void()> deletion_callback_;
 
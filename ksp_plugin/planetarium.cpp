@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 
+#include "base/profiler.hpp"
 #include "geometry/sign.hpp"
 #include "physics/massive_body.hpp"
 #include "physics/similar_motion.hpp"
@@ -16,6 +17,7 @@ namespace ksp_plugin {
 namespace _planetarium {
 namespace internal {
 
+using namespace principia::base::_profiler;
 using namespace principia::geometry::_sign;
 using namespace principia::physics::_massive_body;
 using namespace principia::physics::_similar_motion;
@@ -24,6 +26,10 @@ using namespace principia::quantities::_named_quantities;
 
 namespace {
 constexpr int max_plot_method_2_steps = 10'000;
+// The number of segments that |PlotMethod2| accumulates before hiding them by
+// the spheres, so that the culling in |Perspective::VisibleSegments| has
+// chunks to work with.
+constexpr std::size_t plot_method_2_segments_per_batch = 256;
 }  // namespace
 
 Planetarium::Parameters::Parameters(double const sphere_radius_multiplier,
@@ -52,6 +58,7 @@ RP2Lines<Length, Camera> Planetarium::PlotMethod0(
     DiscreteTrajectory<Barycentric>::iterator const end,
     Instant const& now,
     bool const /*reverse*/) const {
+  Profiler::Scope const scope("Planetarium::PlotMethod0");
   auto const plottable_begin = trajectory.lower_bound(plotting_frame_->t_min());
   auto const plottable_end = trajectory.lower_bound(plotting_frame_->t_max());
   auto const plottable_spheres = ComputePlottableSpheres(now);
@@ -101,6 +108,7 @@ RP2Lines<Length, Camera> Planetarium::PlotMethod1(
     DiscreteTrajectory<Barycentric>::iterator const end,
     Instant const& now,
     bool const reverse) const {
+  Profiler::Scope const scope("Planetarium::PlotMethod1");
   Length const focal_plane_tolerance =
       perspective_.focal() * parameters_.tan_angular_resolution_;
   auto const focal_plane_tolerance² =
@@ -156,6 +164,7 @@ RP2Lines<Length, Camera> Planetarium::PlotMethod2(
     Instant const& now,
     bool const reverse,
     Length* const minimal_distance) const {
+  Profiler::Scope const scope("Planetarium::PlotMethod2");
   RP2Lines<Length, Camera> lines;
   auto const plottable_spheres = ComputePlottableSpheres(now);
   double const tan²_angular_resolution =
@@ -190,6 +199,26 @@ RP2Lines<Length, Camera> Planetarium::PlotMethod2(
   Square<Length> minimal_squared_distance = Infinity<Square<Length>>;
 
   std::optional<Position<Navigation>> last_endpoint;
+  Segments<Navigation> segments_behind_focal_plane;
+  segments_behind_focal_plane.reserve(plot_method_2_segments_per_batch);
+  auto const append_visible_segments = [this,
+                                        &last_endpoint,
+                                        &lines,
+                                        &plottable_spheres,
+                                        &segments_behind_focal_plane]() {
+    auto const visible_segments = perspective_.VisibleSegments(
+                                      segments_behind_focal_plane,
+                                      plottable_spheres);
+    for (auto const& segment : visible_segments) {
+      if (last_endpoint != segment.first) {
+        lines.emplace_back();
+        lines.back().push_back(perspective_(segment.first));
+      }
+      lines.back().push_back(perspective_(segment.second));
+      last_endpoint = segment.second;
+    }
+    segments_behind_focal_plane.clear();
+  };
 
   int steps_accepted = 0;
 
@@ -247,18 +276,13 @@ RP2Lines<Length, Camera> Planetarium::PlotMethod2(
                    perspective_.SquaredDistanceFromCamera(position));
     }
 
-    auto const visible_segments = perspective_.VisibleSegments(
-                                      *segment_behind_focal_plane,
-                                      plottable_spheres);
-    for (auto const& segment : visible_segments) {
-      if (last_endpoint != segment.first) {
-        lines.emplace_back();
-        lines.back().push_back(perspective_(segment.first));
-      }
-      lines.back().push_back(perspective_(segment.second));
-      last_endpoint = segment.second;
+    segments_behind_focal_plane.push_back(*segment_behind_focal_plane);
+    if (segments_behind_focal_plane.size() >=
+        plot_method_2_segments_per_batch) {
+      append_visible_segments();
     }
   }
+  append_visible_segments();
   if (minimal_distance != nullptr) {
     *minimal_distance = Sqrt(minimal_squared_distance);
   }
@@ -274,6 +298,7 @@ void Planetarium::PlotMethod3(
     bool const reverse,
     std::function<void(ScaledSpacePoint const&)> const& add_point,
     int max_points) const {
+  Profiler::Scope const scope("Planetarium::PlotMethod3");
   if (begin == end) {
     return;
   }
@@ -314,9 +339,9 @@ Segments<Navigation> Planetarium::ComputePlottableSegments(
     const std::vector<Sphere<Navigation>>& plottable_spheres,
     DiscreteTrajectory<Barycentric>::iterator const begin,
     DiscreteTrajectory<Barycentric>::iterator const end) const {
-  Segments<Navigation> all_segments;
+  Segments<Navigation> segments_behind_focal_plane;
   if (begin == end) {
-    return all_segments;
+    return segments_behind_focal_plane;
   }
   auto it1 = begin;
   Instant t1 = it1->time;
@@ -342,13 +367,7 @@ Segments<Navigation> Planetarium::ComputePlottableSegments(
     auto const segment_behind_focal_plane =
         perspective_.SegmentBehindFocalPlane(segment);
     if (segment_behind_focal_plane) {
-      // Find the part(s) of the segment that are not hidden by spheres.  These
-      // are the ones we want to plot.
-      auto segments = perspective_.VisibleSegments(*segment_behind_focal_plane,
-                                                   plottable_spheres);
-      std::move(segments.begin(),
-                segments.end(),
-                std::back_inserter(all_segments));
+      segments_behind_focal_plane.push_back(*segment_behind_focal_plane);
     }
 
     it1 = it2;
@@ -357,7 +376,10 @@ Segments<Navigation> Planetarium::ComputePlottableSegments(
     p1 = p2;
   }
 
-  return all_segments;
+  // Find the part(s) of the segments that are not hidden by spheres.  These are
+  // the ones we want to plot.
+  return perspective_.VisibleSegments(segments_behind_focal_plane,
+                                      plottable_spheres);
 }
 
 }  // namespace internal
@@ -4,6 +4,7 @@
 #include <cmath>
 #include <filesystem>
 #include <fstream>
+#include <future>
 #include <ios>
 #include <limits>
 #include <list>
@@ -25,7 +26,9 @@
 #include "base/flags.hpp"
 #include "base/hexadecimal.hpp"
 #include "base/map_util.hpp"
+#include "base/profiler.hpp"
 #include "base/serialization.hpp"
+#include "base/status_utilities.hpp"  // 🧙 For RETURN_IF_ERROR.
 #include "geometry/barycentre_calculator.hpp"
 #include "geometry/frame.hpp"
 #include "geometry/identity.hpp"
@@ -65,6 +68,7 @@ using namespace principia::base::_fingerprint2011;
 using namespace principia::base::_flags;
 using namespace principia::base::_hexadecimal;
 using namespace principia::base::_map_util;
+using namespace principia::base::_profiler;
 using namespace principia::base::_serialization;
 using namespace principia::geometry::_barycentre_calculator;
 using namespace principia::geometry::_frame;
@@ -103,20 +107,54 @@ Length const& MaxCollisionError() {
   return max_collision_error;
 }
 
+// How far ahead of the current time the ephemeris is prolonged in the
+// background, so that the game thread rarely has to integrate the massive
+// bodies itself.
+Time const& EphemerisLookahead() {
+  static Time const ephemeris_lookahead = []() {
+    std::string_view name = "ephemeris_lookahead";
+    if (Flags::IsPresent(name)) {
+      auto const values = Flags::Values(name);
+      CHECK_EQ(values.size(), 1);
+      return ParseQuantity<Time>(*values.begin());
+    } else {
+      return 6 * Hour;
+    }
+  }();
+  return ephemeris_lookahead;
+}
+
 // Keep this consistent with |prediction_steps_| in |main_window.cs|.
 constexpr std::int64_t max_steps_in_prediction = 1 << 24;
 
+// The number of pile-ups whose motions are precomputed by a single task of
+// |vessel_thread_pool_|.  Large enough for the batch evaluation of the Euler
+// solvers to pay off, small enough to use several threads when there are many
+// pile-ups.
+constexpr std::int64_t pile_ups_per_motion_batch = 64;
+
+// Destroying a vessel mostly consists in waiting for its threads to stop, so a
+// few threads suffice.  If the vessels are removed faster than they can be
+// destroyed, the game thread ends up waiting.
+constexpr std::int64_t vessel_gravediggers = 4;
+constexpr std::int64_t max_pending_vessel_burials = 1000;
+
 Plugin::Plugin(std::string const& game_epoch,
                std::string const& solar_system_epoch,
                Angle const& planetarium_rotation)
     : history_downsampling_parameters_(DefaultDownsamplingParameters()),
       history_fixed_step_parameters_(DefaultHistoryParameters()),
+      debris_history_fixed_step_parameters_(DefaultDebrisHistoryParameters()),
       psychohistory_parameters_(DefaultPsychohistoryParameters()),
       vessel_thread_pool_(
           /*pool_size=*/2 * std::thread::hardware_concurrency()),
+      freefall_thread_pool_(
+          /*pool_size=*/std::thread::hardware_concurrency()),
       planetarium_rotation_(planetarium_rotation),
       game_epoch_(ParseTT(game_epoch)),
-      current_time_(ParseTT(solar_system_epoch)) {
+      current_time_(ParseTT(solar_system_epoch)),
+      vessel_graveyard_(/*number_of_threads=*/vessel_gravediggers,
+                        /*max_pending_burials=*/max_pending_vessel_burials) {
   gravity_model_.set_plugin_frame(serialization::Frame::BARYCENTRIC);
   initial_state_.set_epoch(solar_system_epoch);
   initial_state_.set_plugin_frame(serialization::Frame::BARYCENTRIC);
@@ -408,6 +446,9 @@ void Plugin::InsertOrKeepVessel(GUID const& vessel_guid,
   if (loaded) {
     loaded_vessels_.insert(vessel);
   }
+  if (inserted) {
+    dirty_vessels_.insert(vessel);
+  }
   LOG_IF(INFO, inserted) << "Inserted " << (loaded ? "loaded" : "unloaded")
                          << " vessel " << vessel->ShortDebugString();
 }
@@ -426,6 +467,7 @@ void Plugin::InsertUnloadedPart(
       vessel->parent()->current_degrees_of_freedom(current_time_) + relative;
 
   AddPart(vessel, part_id, name, degrees_of_freedom);
+  dirty_vessels_.insert(vessel);
   // NOTE(egg): we do not keep the part; it may disappear just as we load, if
   // it happens to be a part with no physical significance (rb == null).
 }
@@ -474,6 +516,7 @@ void Plugin::InsertOrKeepLoadedPart(
     } else {
       associated_vessel = vessel;
       vessel->AddPart(current_vessel->ExtractPart(part_id));
+      dirty_vessels_.insert(current_vessel);
     }
   } else {
     AddPart(vessel,
@@ -536,17 +579,21 @@ bool Plugin::PartIsTruthful(PartId const part_id) const {
 }
 
 void Plugin::PrepareToReportCollisions() {
-  for (auto const& [_, vessel] : vessels_) {
-    // NOTE(egg): The lifetime requirement on the second argument of
-    // |MakeSingleton| (which forwards to the argument of the constructor of
-    // |Subset<Part>::Properties|) is that |part| outlives the constructed
-    // |Properties|; since these are owned by |part|, this is true.
-    vessel->ForAllParts(
-        [](Part& part) { Subset<Part>::MakeSingleton(part, &part); });
+  // The vessels that are neither loaded nor dirty have not changed since their
+  // pile-ups were last collected, so there is no need to rebind them.
+  vessels_to_collect_.clear();
+  for (not_null<Vessel*> const vessel : loaded_vessels_) {
+    AddVesselToCollect(vessel);
+  }
+  for (not_null<Vessel*> const vessel : dirty_vessels_) {
+    AddVesselToCollect(vessel);
   }
+  dirty_vessels_.clear();
 }
 
 void Plugin::ReportGroundCollision(PartId const part) const {
+  // In practice the colliding vessels are loaded, so this is a no-op.
+  AddVesselToCollect(FindOrDie(part_id_to_vessel_, part));
   Vessel const& v = *FindOrDie(part_id_to_vessel_, part);
   Part& p = *v.part(part);
   LOG(INFO) << "Collision between " << p.ShortDebugString()
@@ -555,6 +602,8 @@ void Plugin::ReportGroundCollision(PartId const part) const {
 }
 
 void Plugin::ReportPartCollision(PartId const part1, PartId const part2) const {
+  AddVesselToCollect(FindOrDie(part_id_to_vessel_, part1));
+  AddVesselToCollect(FindOrDie(part_id_to_vessel_, part2));
   Vessel const& v1 = *FindOrDie(part_id_to_vessel_, part1);
   Vessel const& v2 = *FindOrDie(part_id_to_vessel_, part2);
   Part& p1 = *v1.part(part1);
@@ -576,7 +625,8 @@ void Plugin::FreeVesselsAndPartsAndCollectPileUps(Time const& Δt) {
   // Remove the vessels that we don't want to keep.  Vessels that are not kept
   // have had no reported collisions, so their part subsets do not intersect
   // with the subsets in kept vessels, and none of the part subsets that remain
-  // contain deleted parts.
+  // contain deleted parts.  The vessels that shared a pile-up with a removed
+  // vessel must be collected since that pile-up is going away.
   for (auto it = vessels_.cbegin(); it != vessels_.cend();) {
     not_null<Vessel*> const vessel = it->second.get();
     Instant const vessel_time =
@@ -585,12 +635,15 @@ void Plugin::FreeVesselsAndPartsAndCollectPileUps(Time const& Δt) {
       vessel->CreateTrajectoryIfNeeded(vessel_time);
       ++it;
     } else {
+      AddVesselToCollect(vessel);
+      vessels_to_collect_.erase(vessel);
       loaded_vessels_.erase(vessel);
       LOG(INFO) << "Removing vessel " << vessel->ShortDebugString();
       renderer_->ClearTargetVesselIf(vessel);
       zombie_prediction_adaptive_step_parameters_.insert_or_assign(
           vessel->guid(), vessel->prediction_adaptive_step_parameters());
-      it = vessels_.erase(it);
+      // |extract| does not invalidate the other iterators.
+      BuryVessel(it++);
     }
   }
   CHECK(kept_vessels_.empty());
@@ -603,8 +656,8 @@ void Plugin::FreeVesselsAndPartsAndCollectPileUps(Time const& Δt) {
 
   // Bind the vessels.  This guarantees that all part subsets are disjoint
   // unions of vessels.
-  for (auto const& [_, vessel] : vessels_) {
-    vessel->ForSomePart([&vessel = vessel](Part& first_part) {
+  for (not_null<Vessel*> const vessel : vessels_to_collect_) {
+    vessel->ForSomePart([vessel](Part& first_part) {
       vessel->ForAllParts([&first_part](Part& part) {
         Subset<Part>::Unite(Subset<Part>::Find(first_part),
                             Subset<Part>::Find(part));
@@ -619,29 +672,33 @@ void Plugin::FreeVesselsAndPartsAndCollectPileUps(Time const& Δt) {
     // Note that we need to go through an intermediate set, since destroying a
     // vessel destroys its parts, which invalidates the intrusive |Subset| data
     // structure.
+    // Only the collected vessels may have been reported as grounded.
     VesselSet grounded_vessels;
-    for (auto const& [_, vessel] : vessels_) {
-      vessel->ForSomePart([&vessel = vessel, &grounded_vessels](Part& part) {
+    for (not_null<Vessel*> const vessel : vessels_to_collect_) {
+      vessel->ForSomePart([vessel, &grounded_vessels](Part& part) {
         if (Subset<Part>::Find(part).properties().grounded()) {
-          grounded_vessels.insert(vessel.get());
+          grounded_vessels.insert(vessel);
         }
       });
     }
     for (not_null<Vessel*> const vessel : grounded_vessels) {
+      vessels_to_collect_.erase(vessel);
       loaded_vessels_.erase(vessel);
       LOG(INFO) << "Removing grounded vessel " << vessel->ShortDebugString();
       renderer_->ClearTargetVesselIf(vessel);
       zombie_prediction_adaptive_step_parameters_.insert_or_assign(
           vessel->guid(), vessel->prediction_adaptive_step_parameters());
-      CHECK_EQ(vessels_.erase(vessel->guid()), 1);
+      auto const it = vessels_.find(vessel->guid());
+      CHECK(it != vessels_.end());
+      BuryVessel(it);
     }
   }
 
   // We only need to collect one part per vessel, since the other parts are in
-  // the same subset.
-  for (auto const& [_, vessel] : vessels_) {
+  // the same subset.  The pile-ups of the other vessels are unchanged.
+  for (not_null<Vessel*> const vessel : vessels_to_collect_) {
     Instant const vessel_time =
-        is_loaded(vessel.get()) ? current_time_ - Δt : current_time_;
+        is_loaded(vessel) ? current_time_ - Δt : current_time_;
     vessel->ForSomePart([&vessel_time, this](Part& first_part) {
       Subset<Part>::Find(first_part).mutable_properties().Collect(
           pile_ups_,
@@ -657,6 +714,11 @@ void Plugin::FreeVesselsAndPartsAndCollectPileUps(Time const& Δt) {
   for (auto const& [_, vessel] : vessels_) {
     vessel->DetectCollapsibilityChange();
   }
+
+  // The vessels loaded during this step must be collected during the next one,
+  // in case they get unloaded.
+  vessels_to_collect_.clear();
+  dirty_vessels_ = loaded_vessels_;
 }
 
 void Plugin::SetPartApparentRigidMotion(
@@ -769,23 +831,86 @@ void Plugin::AdvanceTime(Instant const& t, Angle const& planetarium_rotation) {
   current_time_ = t;
   planetarium_rotation_ = planetarium_rotation;
   ephemeris_->Prolong(current_time_).IgnoreError();
+  ephemeris_->RequestProlongation(current_time_ + EphemerisLookahead());
   UpdatePlanetariumRotation();
   loaded_vessels_.clear();
 }
 
 void Plugin::CatchUpLaggingVessels(VesselSet& collided_vessels) {
+  Profiler::Scope const scope("Plugin::CatchUpLaggingVessels");
   CHECK(!initializing_);
 
-  // Start all the integrations in parallel.
-  std::vector<PileUpFuture> pile_up_futures;
+  // Propagate the attitude of the pile-ups that are not deformed by the game
+  // in batches over their Euler solvers, on the vessel threads.
+  std::vector<not_null<PileUp*>> pile_ups;
+  pile_ups.reserve(pile_ups_.size());
   for (auto* const pile_up : pile_ups_) {
+    pile_ups.push_back(pile_up);
+  }
+  std::vector<std::future<absl::Status>> motion_futures;
+  for (std::int64_t begin = 0;
+       begin < pile_ups.size();
+       begin += pile_ups_per_motion_batch) {
+    std::int64_t const end = std::min<std::int64_t>(
+        begin + pile_ups_per_motion_batch, pile_ups.size());
+    motion_futures.push_back(vessel_thread_pool_.Add(
+        [this,
+         batch = std::vector<not_null<PileUp*>>(pile_ups.begin() + begin,
+                                                pile_ups.begin() + end)]() {
+          PileUp::PrecomputeMotions(batch, current_time_);
+          return absl::OkStatus();
+        }));
+  }
+  for (auto& motion_future : motion_futures) {
+    motion_future.wait();
+  }
+
+  // The pile-ups made only of unloaded debris have their histories advanced in
+  // a single fixed-step ensemble.
+  std::vector<not_null<PileUp*>> debris_pile_ups;
+  std::vector<not_null<PileUp*>> other_pile_ups;
+  for (not_null<PileUp*> const pile_up : pile_ups) {
+    if (std::all_of(pile_up->parts().begin(),
+                    pile_up->parts().end(),
+                    [this](not_null<Part*> const part) {
+                      not_null<Vessel*> const vessel =
+                          FindOrDie(part_id_to_vessel_, part->part_id());
+                      return vessel->is_debris() && !is_loaded(vessel);
+                    })) {
+      debris_pile_ups.push_back(pile_up);
+    } else {
+      other_pile_ups.push_back(pile_up);
+    }
+  }
+
+  // Start the ensemble and the integrations of the other pile-ups in parallel.
+  std::future<absl::Status> const ensemble_future = vessel_thread_pool_.Add(
+      [this, &debris_pile_ups]() {
+        PileUp::AdvanceHistoriesInBulk(debris_pile_ups,
+                                       current_time_,
+                                       debris_history_fixed_step_parameters_);
+        return absl::OkStatus();
+      });
+  std::vector<PileUpFuture> pile_up_futures;
+  auto const start_integration = [this,
+                                  &pile_up_futures](PileUp* const pile_up) {
     pile_up_futures.emplace_back(
         pile_up,
         vessel_thread_pool_.Add([this, pile_up]() {
           // Note that there cannot be contention in the following method as
           // no two pile-ups are advanced at the same time.
-          return pile_up->DeformAndAdvanceTime(current_time_);
+          return pile_up->DeformAndAdvanceTime(current_time_,
+                                               &vessel_thread_pool_);
         }));
+  };
+  for (not_null<PileUp*> const pile_up : other_pile_ups) {
+    start_integration(pile_up);
+  }
+
+  // The debris pile-ups may only be advanced once the ensemble is done.
+  ensemble_future.wait();
+  for (not_null<PileUp*> const pile_up : debris_pile_ups) {
+    start_integration(pile_up);
   }
 
   // Wait for the integrations to finish and figure out which vessels collided
@@ -823,7 +948,7 @@ not_null<std::unique_ptr<PileUpFuture>> Plugin::CatchUpVessel(
         // caller is catching-up two vessels belonging to the same pile-up in
         // parallel.
         absl::Status const status =
-            pile_up->DeformAndAdvanceTime(current_time_);
+            pile_up->DeformAndAdvanceTime(current_time_, &vessel_thread_pool_);
         if (!status.ok()) {
           vessel.DisableDownsampling();
         }
@@ -920,6 +1045,7 @@ void Plugin::SetPredictionAdaptiveStepParameters(
 }
 
 void Plugin::UpdatePrediction(std::vector<GUID> const& vessel_guids) const {
+  Profiler::Scope const scope("Plugin::UpdatePrediction");
   CHECK(!initializing_);
   std::set<not_null<Vessel*>> predicted_vessels;
   for (auto const& guid : vessel_guids) {
@@ -1160,6 +1286,51 @@ void Plugin::ComputeAndRenderNodes(
                                       PlanetariumRotation());
 }
 
+std::vector<absl::StatusOr<RelativeDegreesOfFreedom<Barycentric>>>
+Plugin::FlowFreefall(Index const central_body_index,
+                     std::vector<RelativeDegreesOfFreedom<Barycentric>> const&
+                         initial_degrees_of_freedom,
+                     Instant const& t_initial,
+                     Instant const& t_final) const {
+  CHECK(!initializing_);
+  Celestial const& central_body = *FindOrDie(celestials_, central_body_index);
+
+  // Make sure that the ephemeris covers |t_initial| before evaluating the
+  // central body there.  The integrations will prolong it up to |t_final|.
+  if (t_initial < ephemeris_->t_min()) {
+    ephemeris_->AwaitReanimation(t_initial);
+  }
+  ephemeris_->Prolong(t_initial).IgnoreError();
+
+  std::vector<absl::StatusOr<RelativeDegreesOfFreedom<Barycentric>>> results;
+  results.reserve(initial_degrees_of_freedom.size());
+
+  // Don't bother with the thread pool for a single body.
+  if (initial_degrees_of_freedom.size() == 1) {
+    results.push_back(FlowOneFreefall(central_body,
+                                      initial_degrees_of_freedom.front(),
+                                      t_initial,
+                                      t_final));
+    return results;
+  }
+
+  std::vector<
+      std::future<absl::StatusOr<RelativeDegreesOfFreedom<Barycentric>>>>
+      futures;
+  futures.reserve(initial_degrees_of_freedom.size());
+  for (auto const& degrees_of_freedom : initial_degrees_of_freedom) {
+    futures.push_back(freefall_thread_pool_.Add(
+        [this, &central_body, degrees_of_freedom, t_initial, t_final]() {
+          return FlowOneFreefall(
+              central_body, degrees_of_freedom, t_initial, t_final);
+        }));
+  }
+  for (auto& future : futures) {
+    results.push_back(future.get());
+  }
+  return results;
+}
+
 bool Plugin::HasCelestial(Index const index) const {
   return Contains(celestials_, index);
 }
@@ -1450,8 +1621,13 @@ GeometricPotentialPlotter const& Plugin::geometric_potential_plotter() const {
   return *geometric_potential_plotter_;
 }
 
+IndexedCoastCache& Plugin::indexed_coast_cache() const {
+  return indexed_coast_cache_;
+}
+
 void Plugin::WriteToMessage(
     not_null<serialization::Plugin*> const message) const {
+  Profiler::Scope const scope("Plugin::WriteToMessage");
   LOG(INFO) << __FUNCTION__;
   CHECK(!initializing_);
   if (system_fingerprint_ != 0) {
@@ -1485,17 +1661,23 @@ void Plugin::WriteToMessage(
         return serialization_index_to_pile_up.at(pile_up);
       };
 
-  std::map<not_null<Vessel const*>, GUID const> vessel_to_guid;
+  // Serialize the vessels in a deterministic order, irrespective of the
+  // iteration order of |vessels_|.
+  std::map<GUID, not_null<Vessel const*>> guid_to_vessel;
   for (auto const& [guid, vessel] : vessels_) {
-    vessel_to_guid.emplace(vessel.get(), guid);
+    guid_to_vessel.emplace(guid, vessel.get());
+  }
+  std::map<not_null<Vessel const*>, GUID const> vessel_to_guid;
+  for (auto const& [guid, vessel] : guid_to_vessel) {
+    vessel_to_guid.emplace(vessel, guid);
     auto* const vessel_message = message->add_vessel();
     vessel_message->set_guid(guid);
     vessel->WriteToMessage(vessel_message->mutable_vessel(),
                            serialization_index_for_pile_up);
     Index const parent_index = FindOrDie(celestial_to_index, vessel->parent());
     vessel_message->set_parent_index(parent_index);
-    vessel_message->set_loaded(Contains(loaded_vessels_, vessel.get()));
-    vessel_message->set_kept(Contains(kept_vessels_, vessel.get()));
+    vessel_message->set_loaded(Contains(loaded_vessels_, vessel));
+    vessel_message->set_kept(Contains(kept_vessels_, vessel));
   }
   for (auto const& [part_id, vessel] : part_id_to_vessel_) {
     (*message->mutable_part_id_to_vessel())[part_id] = vessel_to_guid[vessel];
@@ -1529,6 +1711,7 @@ void Plugin::WriteToMessage(
 
 not_null<std::unique_ptr<Plugin>> Plugin::ReadFromMessage(
     serialization::Plugin const& message) {
+  Profiler::Scope const scope("Plugin::ReadFromMessage");
   LOG(INFO) << __FUNCTION__;
 
   auto const history_parameters =
@@ -1601,6 +1784,9 @@ not_null<std::unique_ptr<Plugin>> Plugin::ReadFromMessage(
     if (vessel_message.kept()) {
       plugin->kept_vessels_.insert(vessel.get());
     }
+    // The part subsets are not serialized, so all the pile-ups must be
+    // collected after deserialization.
+    plugin->dirty_vessels_.insert(vessel.get());
     bool const inserted = plugin->vessels_.emplace(
         vessel_message.guid(), std::move(vessel)).second;
     CHECK(inserted);
@@ -1687,9 +1873,14 @@ Plugin::Plugin(
         psychohistory_parameters)
     : history_downsampling_parameters_(DefaultDownsamplingParameters()),
       history_fixed_step_parameters_(std::move(history_parameters)),
+      debris_history_fixed_step_parameters_(DefaultDebrisHistoryParameters()),
       psychohistory_parameters_(std::move(psychohistory_parameters)),
       vessel_thread_pool_(
-          /*pool_size=*/2 * std::thread::hardware_concurrency()) {}
+          /*pool_size=*/2 * std::thread::hardware_concurrency()),
+      freefall_thread_pool_(
+          /*pool_size=*/std::thread::hardware_concurrency()),
+      vessel_graveyard_(/*number_of_threads=*/vessel_gravediggers,
+                        /*max_pending_burials=*/max_pending_vessel_burials) {}
 
 void Plugin::InitializeIndices(std::string const& name,
                                Index const celestial_index,
@@ -1770,6 +1961,27 @@ void Plugin::ReadCelestialsFromMessages(
   }
 }
 
+absl::StatusOr<RelativeDegreesOfFreedom<Barycentric>> Plugin::FlowOneFreefall(
+    Celestial const& central_body,
+    RelativeDegreesOfFreedom<Barycentric> const& initial_degrees_of_freedom,
+    Instant const& t_initial,
+    Instant const& t_final) const {
+  auto parameters = DefaultPredictionParameters();
+  parameters.set_max_steps(max_steps_in_prediction);
+  DiscreteTrajectory<Barycentric> trajectory;
+  RETURN_IF_ERROR(trajectory.Append(
+      t_initial,
+      central_body.current_degrees_of_freedom(t_initial) +
+          initial_degrees_of_freedom));
+  RETURN_IF_ERROR(ephemeris_->FlowWithAdaptiveStep(
+      &trajectory,
+      Ephemeris<Barycentric>::NoIntrinsicAcceleration,
+      t_final,
+      parameters));
+  return trajectory.back().degrees_of_freedom -
+         central_body.current_degrees_of_freedom(t_final);
+}
+
 template<typename... Args>
 void Plugin::AddPart(not_null<Vessel*> const vessel,
                      PartId const part_id,
@@ -1792,6 +2004,40 @@ bool Plugin::is_loaded(not_null<Vessel*> vessel) const {
   return Contains(loaded_vessels_, vessel);
 }
 
+void Plugin::AddVesselToCollect(not_null<Vessel*> const vessel) const {
+  std::vector<not_null<Vessel*>> vessels_to_add = {vessel};
+  std::set<not_null<PileUp const*>> visited_pile_ups;
+  while (!vessels_to_add.empty()) {
+    not_null<Vessel*> const v = vessels_to_add.back();
+    vessels_to_add.pop_back();
+    if (!vessels_to_collect_.insert(v).second) {
+      continue;
+    }
+    v->ForAllParts([this, &vessels_to_add, &visited_pile_ups](Part& part) {
+      if (part.is_piled_up() &&
+          visited_pile_ups.insert(part.containing_pile_up()).second) {
+        for (not_null<Part*> const p : part.containing_pile_up()->parts()) {
+          vessels_to_add.push_back(
+              FindOrDie(part_id_to_vessel_, p->part_id()));
+        }
+      }
+      // NOTE(egg): The lifetime requirement on the second argument of
+      // |MakeSingleton| (which forwards to the argument of the constructor of
+      // |Subset<Part>::Properties|) is that |part| outlives the constructed
+      // |Properties|; since these are owned by |part|, this is true.
+      Subset<Part>::MakeSingleton(part, &part);
+    });
+  }
+}
+
+void Plugin::BuryVessel(GUIDToOwnedVessel::const_iterator const it) {
+  auto node = vessels_.extract(it);
+  not_null<std::unique_ptr<Vessel>>& vessel = node.mapped();
+  // The parts call back into the plugin, so they must be destroyed now.
+  vessel->DestroyParts();
+  vessel_graveyard_.Bury(std::unique_ptr<Vessel>(std::move(vessel)));
+}
+
 }  // namespace internal
 }  // namespace _plugin
 }  // namespace ksp_plugin
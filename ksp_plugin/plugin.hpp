@@ -13,7 +13,9 @@
 
 #include "absl/container/flat_hash_map.h"
 #include "absl/status/status.h"
+#include "absl/status/statusor.h"
 #include "base/disjoint_sets.hpp"
+#include "base/graveyard.hpp"
 #include "base/monostable.hpp"
 #include "base/not_null.hpp"
 #include "base/thread_pool.hpp"
@@ -30,6 +32,7 @@
 #include "ksp_plugin/frames.hpp"
 #include "ksp_plugin/geometric_potential_plotter.hpp"
 #include "ksp_plugin/identification.hpp"
+#include "ksp_plugin/indexed_coast_cache.hpp"
 #include "ksp_plugin/pile_up.hpp"
 #include "ksp_plugin/planetarium.hpp"
 #include "ksp_plugin/renderer.hpp"
@@ -62,6 +65,7 @@ namespace _plugin {
 namespace internal {
 
 using namespace principia::base::_disjoint_sets;
+using namespace principia::base::_graveyard;
 using namespace principia::base::_monostable;
 using namespace principia::base::_not_null;
 using namespace principia::base::_thread_pool;
@@ -78,6 +82,7 @@ using namespace principia::ksp_plugin::_celestial;
 using namespace principia::ksp_plugin::_frames;
 using namespace principia::ksp_plugin::_geometric_potential_plotter;
 using namespace principia::ksp_plugin::_identification;
+using namespace principia::ksp_plugin::_indexed_coast_cache;
 using namespace principia::ksp_plugin::_pile_up;
 using namespace principia::ksp_plugin::_planetarium;
 using namespace principia::ksp_plugin::_renderer;
@@ -246,7 +251,10 @@ class Plugin {
   // Calls |MakeSingleton| for all parts in loaded vessels, enabling the use of
   // union-find for pile up construction.  This must be called after the calls
   // to |ApplyPartIntrinsicForce|, and before the calls to
-  // |ReportGroundCollision| or |ReportPartCollision|.
+  // |ReportGroundCollision| or |ReportPartCollision|.  The parts of the
+  // vessels that were loaded during the previous step or were modified since,
+  // and of the vessels sharing a pile-up with any of the above, are also made
+  // singletons; the pile-ups of the other vessels are left untouched.
   virtual void PrepareToReportCollisions();
 
   // Notifies |this| that the given part is touching the ground.
@@ -260,7 +268,8 @@ class Plugin {
   // since the last call to |FreeVesselsAndCollectPileUps|, as well as the
   // vessels which transitively touch the ground.  Destroys the parts in loaded
   // vessels for which |InsertOrKeepLoadedPart| has not been called.  Updates
-  // the list of |pile_ups_| according to the reported collisions.
+  // the list of |pile_ups_| according to the reported collisions.  Only the
+  // vessels prepared by |PrepareToReportCollisions| are bound and collected.
   virtual void FreeVesselsAndPartsAndCollectPileUps(Time const& Δt);
 
   // Calls |SetPartApparentRigidMotion| on the pile-up containing the relevant
@@ -302,9 +311,10 @@ class Plugin {
 
   // Advances time to |current_time_| for all pile ups that are not already
   // there, filling the tails of all their parts up to that instant; then
-  // advances time on all vessels that are not yet at |current_time_|.  Inserts
-  // the set of vessels that have collided with a celestial into
-  // |collided_vessels|.
+  // advances time on all vessels that are not yet at |current_time_|.  The
+  // histories of the pile-ups made only of unloaded debris are advanced
+  // together, with a long fixed step.  Inserts the set of vessels that have
+  // collided with a celestial into |collided_vessels|.
   virtual void CatchUpLaggingVessels(VesselSet& collided_vessels);
 
   // Advances time to |current_time_| on the pile up containing the given
@@ -403,6 +413,20 @@ class Plugin {
       std::vector<Renderer::Node>& ascending,
       std::vector<Renderer::Node>& descending) const;
 
+  // Integrates the free fall of massless bodies in the gravitational field of
+  // the celestials, using the default prediction parameters.  The bodies have
+  // the given |initial_degrees_of_freedom| relative to the celestial with index
+  // |central_body_index| at |t_initial|; the results are relative to the same
+  // celestial at |t_final|, and are in the same order.  The bodies are
+  // integrated in parallel.  This function is thread-safe, and in particular it
+  // may be called while the prognosticators are running.
+  virtual std::vector<absl::StatusOr<RelativeDegreesOfFreedom<Barycentric>>>
+  FlowFreefall(Index central_body_index,
+               std::vector<RelativeDegreesOfFreedom<Barycentric>> const&
+                   initial_degrees_of_freedom,
+               Instant const& t_initial,
+               Instant const& t_final) const;
+
   virtual bool HasCelestial(Index index) const;
   virtual Celestial const& GetCelestial(Index index) const;
 
@@ -482,13 +506,19 @@ class Plugin {
   virtual GeometricPotentialPlotter& geometric_potential_plotter();
   virtual GeometricPotentialPlotter const& geometric_potential_plotter() const;
 
+  // The cache used to find the nearest points of the planned coasts on behalf
+  // of other mods.  It is thread-safe and does not affect the state of the
+  // plugin.
+  IndexedCoastCache& indexed_coast_cache() const;
+
   // Must be called after initialization.
   virtual void WriteToMessage(not_null<serialization::Plugin*> message) const;
   static not_null<std::unique_ptr<Plugin>> ReadFromMessage(
       serialization::Plugin const& message);
 
  private:
-  using GUIDToOwnedVessel = std::map<GUID, not_null<std::unique_ptr<Vessel>>>;
+  using GUIDToOwnedVessel =
+      absl::flat_hash_map<GUID, not_null<std::unique_ptr<Vessel>>>;
   using IndexToOwnedCelestial =
       std::map<Index, not_null<std::unique_ptr<Celestial>>>;
   using NewtonianMotionEquation =
@@ -521,6 +551,13 @@ class Plugin {
       IndexToOwnedCelestial& celestials,
       std::map<std::string, Index>& name_to_index);
 
+  // Integrates the free fall of a single massless body for |FlowFreefall|.
+  absl::StatusOr<RelativeDegreesOfFreedom<Barycentric>> FlowOneFreefall(
+      Celestial const& central_body,
+      RelativeDegreesOfFreedom<Barycentric> const& initial_degrees_of_freedom,
+      Instant const& t_initial,
+      Instant const& t_final) const;
+
   // Constructs a part using the constructor arguments, and add it to a vessel,
   // recording it in the appropriate map and setting up a deletion callback.
   template<typename... Args>
@@ -532,6 +569,16 @@ class Plugin {
   // Whether |loaded_vessels_| contains |vessel|.
   bool is_loaded(not_null<Vessel*> vessel) const;
 
+  // Inserts |vessel| in |vessels_to_collect_| and calls |MakeSingleton| for
+  // its parts, and does the same, transitively, for the vessels that share a
+  // pile-up with it.  This ensures that a pile-up is either entirely collected
+  // or entirely left alone.
+  void AddVesselToCollect(not_null<Vessel*> vessel) const;
+
+  // Removes the vessel at |it| from |vessels_|, destroys its parts and hands it
+  // over to |vessel_graveyard_|.
+  void BuryVessel(GUIDToOwnedVessel::const_iterator it);
+
   // Initialization objects.
   Monostable initializing_;
   serialization::GravityModel gravity_model_;
@@ -562,11 +609,23 @@ class Plugin {
   DiscreteTrajectorySegment<Barycentric>::DownsamplingParameters
       history_downsampling_parameters_;
   Ephemeris<Barycentric>::FixedStepParameters history_fixed_step_parameters_;
+  // Not persisted.
+  Ephemeris<Barycentric>::FixedStepParameters
+      debris_history_fixed_step_parameters_;
   Ephemeris<Barycentric>::AdaptiveStepParameters psychohistory_parameters_;
 
   // The thread pool for advancing vessels.
   ThreadPool<absl::Status> vessel_thread_pool_;
 
+  // The thread pool for the free falls computed on behalf of other mods.  It
+  // is distinct from |vessel_thread_pool_| so that external requests never
+  // delay the catching-up of the vessels.
+  mutable ThreadPool<absl::StatusOr<RelativeDegreesOfFreedom<Barycentric>>>
+      freefall_thread_pool_;
+
+  // Not persisted.
+  mutable IndexedCoastCache indexed_coast_cache_;
+
   Angle planetarium_rotation_;
   std::optional<Rotation<Barycentric, AliceSun>> cached_planetarium_rotation_;
   std::optional<Rotation<CameraCompensatedReference, CameraReference>>
@@ -593,6 +652,15 @@ class Plugin {
   VesselSet loaded_vessels_;
   // The vessels that will be kept during the next call to |AdvanceTime|.
   VesselConstSet kept_vessels_;
+  // The vessels whose pile-ups must be recomputed by the next call to
+  // |FreeVesselsAndPartsAndCollectPileUps| even if they are not loaded: those
+  // that were loaded during the previous step, those that were inserted or that
+  // gained or lost parts, and those that were just deserialized.
+  VesselSet dirty_vessels_;
+  // The vessels whose parts were made singletons during this step, and that
+  // will be bound and collected.  Computed by |PrepareToReportCollisions|, and
+  // extended by the reporting of collisions, which is logically const.
+  mutable VesselSet vessels_to_collect_;
   // Contains the adaptive step parameters for the vessel that existed in the
   // past but are no longer known to the plugin.  Useful to avoid losing the
   // parameters, e.g., when a vessel hits the ground.
@@ -603,6 +671,11 @@ class Plugin {
 
   std::optional<GeometricPotentialPlotter> geometric_potential_plotter_;
 
+  // Where the removed vessels are destroyed, as their destruction waits for
+  // their prognosticator and reanimator to stop.  Declared last so that it is
+  // flushed before the ephemeris used by these threads is destroyed.
+  Graveyard vessel_graveyard_;
+
   friend class NavballFrameField;
   friend class ksp_plugin::TestablePlugin;
 };
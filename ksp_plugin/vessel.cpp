@@ -2,7 +2,9 @@
 
 #include <algorithm>
 #include <functional>
+#include <iterator>
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
 #include <utility>
@@ -32,6 +34,24 @@ using namespace std::chrono_literals;
 // TODO(phl): Move this to some kind of parameters.
 constexpr std::int64_t max_points_to_serialize = 20'000;
 
+namespace {
+
+bool LevelsOfDetailDiffer(
+    std::optional<Vessel::PredictionLevelOfDetail> const& left,
+    std::optional<Vessel::PredictionLevelOfDetail> const& right) {
+  if (!left.has_value() || !right.has_value()) {
+    return left.has_value() != right.has_value();
+  }
+  return left->full_accuracy_duration != right->full_accuracy_duration ||
+         left->tolerance_multiplier != right->tolerance_multiplier ||
+         left->downsampling_parameters.max_dense_intervals !=
+             right->downsampling_parameters.max_dense_intervals ||
+         left->downsampling_parameters.tolerance !=
+             right->downsampling_parameters.tolerance;
+}
+
+}  // namespace
+
 bool operator!=(Vessel::PrognosticatorParameters const& left,
                 Vessel::PrognosticatorParameters const& right) {
   return left.first_time != right.first_time ||
@@ -43,7 +63,8 @@ bool operator!=(Vessel::PrognosticatorParameters const& left,
          left.adaptive_step_parameters.length_integration_tolerance() !=
              right.adaptive_step_parameters.length_integration_tolerance() ||
          left.adaptive_step_parameters.speed_integration_tolerance() !=
-             right.adaptive_step_parameters.speed_integration_tolerance();
+             right.adaptive_step_parameters.speed_integration_tolerance() ||
+         LevelsOfDetailDiffer(left.level_of_detail, right.level_of_detail);
 }
 
 Vessel::Vessel(
@@ -160,6 +181,11 @@ void Vessel::FreeParts() {
   kept_parts_.clear();
 }
 
+void Vessel::DestroyParts() {
+  parts_.clear();
+  kept_parts_.clear();
+}
+
 void Vessel::ClearAllIntrinsicForcesAndTorques() {
   for (auto const& [_, part] : parts_) {
     part->clear_intrinsic_force();
@@ -323,6 +349,28 @@ Vessel::prediction_adaptive_step_parameters() const {
   return prediction_adaptive_step_parameters_;
 }
 
+void Vessel::set_prediction_level_of_detail(
+    std::optional<PredictionLevelOfDetail> const& level_of_detail) {
+  prediction_level_of_detail_ = level_of_detail;
+}
+
+std::optional<Vessel::PredictionLevelOfDetail> const&
+Vessel::prediction_level_of_detail() const {
+  return prediction_level_of_detail_;
+}
+
+std::optional<Instant> const& Vessel::prediction_reduced_accuracy_time() const {
+  return prediction_reduced_accuracy_time_;
+}
+
+void Vessel::set_debris(bool const debris) {
+  is_debris_ = debris;
+}
+
+bool Vessel::is_debris() const {
+  return is_debris_;
+}
+
 bool Vessel::has_flight_plan() const {
   return !flight_plans_.empty();
 }
@@ -447,7 +495,9 @@ void Vessel::AdvanceTime() {
   if (optional_prognostication.has_value()) {
     AttachPrediction(std::move(optional_prognostication.value()));
   } else {
-    AttachPrediction(std::move(prediction));
+    AttachPrediction(
+        {.trajectory = std::move(prediction),
+         .reduced_accuracy_time = prediction_reduced_accuracy_time_});
   }
 
   for (auto const& [_, part] : parts_) {
@@ -602,15 +652,19 @@ absl::Status Vessel::RebaseFlightPlan(Mass const& initial_mass) {
 void Vessel::RefreshPrediction() {
   // The |prognostication| is a trajectory which is computed asynchronously and
   // may be used as a prediction;
-  std::optional<DiscreteTrajectory<Barycentric>> prognostication;
+  std::optional<Prognostication> prognostication;
 
   // Note that we know that |RefreshPrediction| is called on the main thread,
   // therefore the ephemeris currently covers the last time of the
   // psychohistory.  Were this to change, this code might have to change.
+  auto adaptive_step_parameters = prediction_adaptive_step_parameters_;
+  adaptive_step_parameters.set_first_time_step(
+      PredictionTimeStepAt(psychohistory_->back().time));
   PrognosticatorParameters prognosticator_parameters{
       psychohistory_->back().time,
       psychohistory_->back().degrees_of_freedom,
-      prediction_adaptive_step_parameters_};
+      std::move(adaptive_step_parameters),
+      prediction_level_of_detail_};
   if (synchronous_) {
     auto status_or_prognostication =
         FlowPrognostication(std::move(prognosticator_parameters));
@@ -742,6 +796,22 @@ void Vessel::WriteToMessage(not_null<serialization::Vessel*> const message,
   }
   message->set_selected_flight_plan_index(selected_flight_plan_index_);
   message->set_is_collapsible(is_collapsible_);
+  message->set_is_debris(is_debris_);
+  if (prediction_level_of_detail_.has_value()) {
+    auto const& level_of_detail = *prediction_level_of_detail_;
+    auto* const serialized_level_of_detail =
+        message->mutable_prediction_level_of_detail();
+    level_of_detail.full_accuracy_duration.WriteToMessage(
+        serialized_level_of_detail->mutable_full_accuracy_duration());
+    serialized_level_of_detail->set_tolerance_multiplier(
+        level_of_detail.tolerance_multiplier);
+    auto* const serialized_downsampling_parameters =
+        serialized_level_of_detail->mutable_downsampling_parameters();
+    serialized_downsampling_parameters->set_max_dense_intervals(
+        level_of_detail.downsampling_parameters.max_dense_intervals);
+    level_of_detail.downsampling_parameters.tolerance.WriteToMessage(
+        serialized_downsampling_parameters->mutable_tolerance());
+  }
   checkpointer_->WriteToMessage(message->mutable_checkpoint());
   LOG(INFO) << name_ << " " << NAMED(message->SpaceUsed()) << " "
             << NAMED(message->ByteSize());
@@ -792,6 +862,19 @@ not_null<std::unique_ptr<Vessel>> Vessel::ReadFromMessage(
     CHECK(Contains(vessel->parts_, part_id));
     vessel->kept_parts_.insert(part_id);
   }
+  vessel->is_debris_ = message.is_debris();
+  if (message.has_prediction_level_of_detail()) {
+    auto const& level_of_detail = message.prediction_level_of_detail();
+    vessel->prediction_level_of_detail_ = PredictionLevelOfDetail{
+        .full_accuracy_duration =
+            Time::ReadFromMessage(level_of_detail.full_accuracy_duration()),
+        .tolerance_multiplier = level_of_detail.tolerance_multiplier(),
+        .downsampling_parameters = {
+            .max_dense_intervals =
+                level_of_detail.downsampling_parameters().max_dense_intervals(),
+            .tolerance = Length::ReadFromMessage(
+                level_of_detail.downsampling_parameters().tolerance())}};
+  }
 
   if (is_pre_cesàro) {
     auto const psychohistory =
@@ -1099,32 +1182,91 @@ bool Vessel::DesiredTMinReachedOrFullyReanimated(
          oldest_reanimated_checkpoint_ == checkpointer_->oldest_checkpoint();
 }
 
-absl::StatusOr<DiscreteTrajectory<Barycentric>> Vessel::FlowPrognostication(
+absl::StatusOr<Vessel::Prognostication> Vessel::FlowPrognostication(
     PrognosticatorParameters prognosticator_parameters) {
-  DiscreteTrajectory<Barycentric> prognostication;
-  prognostication.Append(
+  Prognostication prognostication;
+  DiscreteTrajectory<Barycentric>& trajectory = prognostication.trajectory;
+  trajectory.Append(
       prognosticator_parameters.first_time,
       prognosticator_parameters.first_degrees_of_freedom).IgnoreError();
-  absl::Status status;
-  status = ephemeris_->FlowWithAdaptiveStep(
-      &prognostication,
-      Ephemeris<Barycentric>::NoIntrinsicAcceleration,
-      ephemeris_->t_max(),
-      prognosticator_parameters.adaptive_step_parameters,
-      FlightPlan::max_ephemeris_steps_per_frame);
+
+  auto const& level_of_detail = prognosticator_parameters.level_of_detail;
+  Instant const reduced_accuracy_time =
+      level_of_detail.has_value()
+          ? prognosticator_parameters.first_time +
+                level_of_detail->full_accuracy_duration
+          : InfiniteFuture;
+  auto reduced_accuracy_parameters =
+      prognosticator_parameters.adaptive_step_parameters;
+  if (level_of_detail.has_value()) {
+    reduced_accuracy_parameters.set_length_integration_tolerance(
+        reduced_accuracy_parameters.length_integration_tolerance() *
+        level_of_detail->tolerance_multiplier);
+    reduced_accuracy_parameters.set_speed_integration_tolerance(
+        reduced_accuracy_parameters.speed_integration_tolerance() *
+        level_of_detail->tolerance_multiplier);
+  }
+
+  // The part of the prognostication beyond |reduced_accuracy_time|.  It is
+  // downsampled as it is integrated, and appended to the |trajectory| at the
+  // end.
+  std::optional<DiscreteTrajectory<Barycentric>> reduced_accuracy_trajectory;
+  // Integrates the prognostication until |t|, switching to the reduced
+  // accuracy at |reduced_accuracy_time|.
+  auto const flow = [this,
+                     &level_of_detail,
+                     &prognosticator_parameters,
+                     reduced_accuracy_time,
+                     &reduced_accuracy_parameters,
+                     &reduced_accuracy_trajectory,
+                     &trajectory](Instant const& t) -> absl::Status {
+    if (!reduced_accuracy_trajectory.has_value()) {
+      if (t <= reduced_accuracy_time) {
+        return ephemeris_->FlowWithAdaptiveStep(
+            &trajectory,
+            Ephemeris<Barycentric>::NoIntrinsicAcceleration,
+            t,
+            prognosticator_parameters.adaptive_step_parameters,
+            FlightPlan::max_ephemeris_steps_per_frame);
+      }
+      RETURN_IF_ERROR(ephemeris_->FlowWithAdaptiveStep(
+          &trajectory,
+          Ephemeris<Barycentric>::NoIntrinsicAcceleration,
+          reduced_accuracy_time,
+          prognosticator_parameters.adaptive_step_parameters,
+          FlightPlan::max_ephemeris_steps_per_frame));
+      reduced_accuracy_trajectory.emplace();
+      reduced_accuracy_trajectory->segments().begin()->SetDownsampling(
+          level_of_detail->downsampling_parameters);
+      reduced_accuracy_trajectory->Append(
+          trajectory.back().time,
+          trajectory.back().degrees_of_freedom).IgnoreError();
+    }
+    return ephemeris_->FlowWithAdaptiveStep(
+        &*reduced_accuracy_trajectory,
+        Ephemeris<Barycentric>::NoIntrinsicAcceleration,
+        t,
+        reduced_accuracy_parameters,
+        FlightPlan::max_ephemeris_steps_per_frame);
+  };
+
+  absl::Status status = flow(ephemeris_->t_max());
   bool const reached_t_max = status.ok();
   if (reached_t_max) {
     // This will prolong the ephemeris by |max_ephemeris_steps_per_frame|.
-    status = ephemeris_->FlowWithAdaptiveStep(
-        &prognostication,
-        Ephemeris<Barycentric>::NoIntrinsicAcceleration,
-        InfiniteFuture,
-        prognosticator_parameters.adaptive_step_parameters,
-        FlightPlan::max_ephemeris_steps_per_frame);
+    status = flow(InfiniteFuture);
+  }
+  if (reduced_accuracy_trajectory.has_value()) {
+    prognostication.reduced_accuracy_time = trajectory.back().time;
+    for (auto it = std::next(reduced_accuracy_trajectory->begin());
+         it != reduced_accuracy_trajectory->end();
+         ++it) {
+      trajectory.Append(it->time, it->degrees_of_freedom).IgnoreError();
+    }
   }
   LOG_IF_EVERY_N(INFO, !status.ok(), 50)
       << "Prognostication from " << prognosticator_parameters.first_time
-      << " finished at " << prognostication.back().time << " with "
+      << " finished at " << trajectory.back().time << " with "
       << status.ToString() << " for " << ShortDebugString();
   if (absl::IsCancelled(status)) {
     return status;
@@ -1135,6 +1277,33 @@ absl::StatusOr<DiscreteTrajectory<Barycentric>> Vessel::FlowPrognostication(
   }
 }
 
+std::optional<Time> Vessel::PredictionTimeStepAt(Instant const& t) const {
+  // The number of intervals of the prediction that we look at.  The last step
+  // of each flow is truncated to end exactly at the desired time, so we take
+  // the largest of a few intervals.
+  constexpr int intervals = 3;
+  if (prediction_ == trajectory_.segments().end()) {
+    return std::nullopt;
+  }
+  std::optional<Time> time_step;
+  auto it = prediction_->lower_bound(t);
+  for (int i = 0; i < intervals && it != prediction_->end(); ++i) {
+    auto const next = std::next(it);
+    // Beyond |prediction_reduced_accuracy_time_| the prediction is downsampled
+    // so its intervals are not steps of the integrator.
+    if (next == prediction_->end() ||
+        (prediction_reduced_accuracy_time_.has_value() &&
+         next->time > prediction_reduced_accuracy_time_.value())) {
+      break;
+    }
+    Time const interval = next->time - it->time;
+    time_step = time_step.has_value() ? std::max(time_step.value(), interval)
+                                      : interval;
+    it = next;
+  }
+  return time_step;
+}
+
 void Vessel::AppendToVesselTrajectory(
     TrajectoryIterator const part_trajectory_begin,
     TrajectoryIterator const part_trajectory_end,
@@ -1189,7 +1358,9 @@ void Vessel::AppendToVesselTrajectory(
   }
 }
 
-void Vessel::AttachPrediction(DiscreteTrajectory<Barycentric>&& trajectory) {
+void Vessel::AttachPrediction(Prognostication&& prognostication) {
+  auto& trajectory = prognostication.trajectory;
+  prediction_reduced_accuracy_time_ = prognostication.reduced_accuracy_time;
   trajectory.ForgetBefore(psychohistory_->back().time);
   if (trajectory.empty()) {
     prediction_ = trajectory_.NewSegment();
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <queue>
 #include <string>
 #include <variant>
@@ -77,6 +78,17 @@ class Vessel {
   using Manœuvres = std::vector<
       not_null<std::unique_ptr<Manœuvre<Barycentric, Navigation> const>>>;
 
+  // Parameters for computing the far future of the prediction at a lower
+  // accuracy.  The prediction is computed with the prediction adaptive step
+  // parameters for |full_accuracy_duration|, and beyond that with tolerances
+  // multiplied by |tolerance_multiplier| and with the given downsampling.
+  struct PredictionLevelOfDetail {
+    Time full_accuracy_duration;
+    double tolerance_multiplier;
+    DiscreteTrajectorySegment<Barycentric>::DownsamplingParameters
+        downsampling_parameters;
+  };
+
   // Constructs a vessel whose parent is initially |*parent|.
   Vessel(GUID guid,
          std::string name,
@@ -127,6 +139,10 @@ class Vessel {
   // removals; thus a call to |AddPart| must occur before |FreeParts| is first
   // called.
   virtual void FreeParts();
+  // Destroys all the parts of this vessel, which may then only be destroyed.
+  // The parts call back into the plugin and must be destroyed on the main
+  // thread, whereas the rest of the vessel may be destroyed asynchronously.
+  void DestroyParts();
 
   // Clears the forces and torques on all parts.
   virtual void ClearAllIntrinsicForcesAndTorques();
@@ -166,6 +182,24 @@ class Vessel {
   virtual Ephemeris<Barycentric>::AdaptiveStepParameters const&
   prediction_adaptive_step_parameters() const;
 
+  // If |level_of_detail| is null, the entire prediction is computed at full
+  // accuracy, which is the default.  Takes effect at the next refresh of the
+  // prediction.
+  virtual void set_prediction_level_of_detail(
+      std::optional<PredictionLevelOfDetail> const& level_of_detail);
+  virtual std::optional<PredictionLevelOfDetail> const&
+  prediction_level_of_detail() const;
+
+  // Returns the time after which the current prediction was computed at
+  // reduced accuracy, or null if it was entirely computed at full accuracy.
+  virtual std::optional<Instant> const& prediction_reduced_accuracy_time()
+      const;
+
+  // Whether this vessel is debris.  The histories of unloaded debris are
+  // advanced in bulk with long fixed steps.
+  virtual void set_debris(bool debris);
+  virtual bool is_debris() const;
+
   // Returns true iff the vessel has a flight plan, deserialized or not.  Never
   // fails.
   virtual bool has_flight_plan() const;
@@ -317,10 +351,18 @@ class Vessel {
     Instant first_time;
     DegreesOfFreedom<Barycentric> first_degrees_of_freedom;
     Ephemeris<Barycentric>::AdaptiveStepParameters adaptive_step_parameters;
+    std::optional<PredictionLevelOfDetail> level_of_detail;
   };
   friend bool operator!=(PrognosticatorParameters const& left,
                          PrognosticatorParameters const& right);
 
+  struct Prognostication {
+    DiscreteTrajectory<Barycentric> trajectory;
+    // The time after which the |trajectory| was computed at reduced accuracy,
+    // if any.
+    std::optional<Instant> reduced_accuracy_time;
+  };
+
   using TrajectoryIterator =
       DiscreteTrajectory<Barycentric>::iterator (Part::*)();
 
@@ -361,9 +403,15 @@ class Vessel {
 
   // Runs the integrator to compute the |prognostication_| based on the given
   // parameters.
-  absl::StatusOr<DiscreteTrajectory<Barycentric>>
+  absl::StatusOr<Prognostication>
   FlowPrognostication(PrognosticatorParameters prognosticator_parameters);
 
+  // Returns the step size used by the integrator around time |t| when
+  // computing the current |prediction_|, if known.  This is used to seed the
+  // step size control of the next prognostication, which starts at about the
+  // same time and goes through nearly identical dynamics.
+  std::optional<Time> PredictionTimeStepAt(Instant const& t) const;
+
   // Appends to |trajectory_| the centre of mass of the trajectories of the
   // parts denoted by |part_trajectory_begin| and |part_trajectory_end|.  Only
   // the points that are strictly after the start of the |segment| are used.
@@ -372,9 +420,10 @@ class Vessel {
       TrajectoryIterator part_trajectory_end,
       DiscreteTrajectorySegment<Barycentric> const& segment);
 
-  // Attaches the given |trajectory| to the end of the |psychohistory_| to
-  // become the new |prediction_|.  If |prediction_| is not null, it is deleted.
-  void AttachPrediction(DiscreteTrajectory<Barycentric>&& trajectory);
+  // Attaches the trajectory of the given |prognostication| to the end of the
+  // |psychohistory_| to become the new |prediction_|.  If |prediction_| is not
+  // null, it is deleted.
+  void AttachPrediction(Prognostication&& prognostication);
 
   // A vessel is collapsible if it is alone in its pile-up and is in inertial
   // motion.
@@ -392,6 +441,8 @@ class Vessel {
   MasslessBody const body_;
   Ephemeris<Barycentric>::AdaptiveStepParameters
       prediction_adaptive_step_parameters_;
+  std::optional<PredictionLevelOfDetail> prediction_level_of_detail_;
+  bool is_debris_ = false;
   // The parent body for the 2-body approximation.
   not_null<Celestial const*> parent_;
   not_null<Ephemeris<Barycentric>*> const ephemeris_;
@@ -442,9 +493,9 @@ class Vessel {
   // |prediction_| is the segment following the |psychohistory_|.
   DiscreteTrajectorySegmentIterator<Barycentric> psychohistory_;
   DiscreteTrajectorySegmentIterator<Barycentric> prediction_;
+  std::optional<Instant> prediction_reduced_accuracy_time_;
 
-  RecurringThread<PrognosticatorParameters,
-                  DiscreteTrajectory<Barycentric>> prognosticator_;
+  RecurringThread<PrognosticatorParameters, Prognostication> prognosticator_;
 
   std::vector<LazilyDeserializedFlightPlan> flight_plans_;
   int selected_flight_plan_index_ = -1;
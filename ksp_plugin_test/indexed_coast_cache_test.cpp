@@ -0,0 +1,198 @@
+#include "ksp_plugin/indexed_coast_cache.hpp"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "astronomy/epoch.hpp"
+#include "base/not_null.hpp"
+#include "geometry/instant.hpp"
+#include "geometry/space.hpp"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "integrators/embedded_explicit_generalized_runge_kutta_nyström_integrator.hpp"
+#include "integrators/embedded_explicit_runge_kutta_nyström_integrator.hpp"
+#include "integrators/methods.hpp"
+#include "integrators/symmetric_linear_multistep_integrator.hpp"
+#include "ksp_plugin/flight_plan.hpp"
+#include "ksp_plugin/frames.hpp"
+#include "physics/body_centred_non_rotating_reference_frame.hpp"
+#include "physics/degrees_of_freedom.hpp"
+#include "physics/ephemeris.hpp"
+#include "physics/massive_body.hpp"
+#include "physics/reference_frame.hpp"
+#include "physics/rotating_body.hpp"
+#include "quantities/named_quantities.hpp"
+#include "quantities/quantities.hpp"
+#include "quantities/si.hpp"
+#include "testing_utilities/matchers.hpp"
+
+namespace principia {
+namespace ksp_plugin {
+
+using ::testing::ElementsAreArray;
+using ::testing::Eq;
+using ::testing::Not;
+using namespace principia::astronomy::_epoch;
+using namespace principia::base::_not_null;
+using namespace principia::geometry::_instant;
+using namespace principia::geometry::_space;
+using namespace principia::integrators::_embedded_explicit_generalized_runge_kutta_nyström_integrator;  // NOLINT
+using namespace principia::integrators::_embedded_explicit_runge_kutta_nyström_integrator;  // NOLINT
+using namespace principia::integrators::_methods;
+using namespace principia::integrators::_symmetric_linear_multistep_integrator;
+using namespace principia::ksp_plugin::_flight_plan;
+using namespace principia::ksp_plugin::_frames;
+using namespace principia::ksp_plugin::_indexed_coast_cache;
+using namespace principia::physics::_body_centred_non_rotating_reference_frame;
+using namespace principia::physics::_degrees_of_freedom;
+using namespace principia::physics::_ephemeris;
+using namespace principia::physics::_massive_body;
+using namespace principia::physics::_reference_frame;
+using namespace principia::physics::_rotating_body;
+using namespace principia::quantities::_named_quantities;
+using namespace principia::quantities::_quantities;
+using namespace principia::quantities::_si;
+using namespace principia::testing_utilities::_matchers;
+
+class IndexedCoastCacheTest : public testing::Test {
+ protected:
+  using TestNavigationFrame =
+      BodyCentredNonRotatingReferenceFrame<Barycentric, Navigation>;
+
+  IndexedCoastCacheTest() {
+    std::vector<not_null<std::unique_ptr<MassiveBody const>>> bodies;
+    bodies.emplace_back(make_not_null_unique<RotatingBody<Barycentric>>(
+        1 * Pow<3>(Metre) / Pow<2>(Second),
+        RotatingBody<Barycentric>::Parameters(
+            /*mean_radius=*/1 * Metre,
+            /*reference_angle=*/0 * Radian,
+            /*reference_instant=*/J2000,
+            /*angular_frequency=*/1 * Radian / Second,
+            /*right_ascension_of_pole=*/0 * Radian,
+            /*declination_of_pole=*/0 * Radian)));
+    std::vector<DegreesOfFreedom<Barycentric>> initial_state{
+        {Barycentric::origin, Barycentric::unmoving}};
+    ephemeris_ = std::make_unique<Ephemeris<Barycentric>>(
+        std::move(bodies),
+        initial_state,
+        /*initial_time=*/t0_,
+        Ephemeris<Barycentric>::AccuracyParameters(
+            /*fitting_tolerance=*/1 * Milli(Metre),
+            /*geopotential_tolerance=*/0x1p-24),
+        Ephemeris<Barycentric>::FixedStepParameters(
+            SymmetricLinearMultistepIntegrator<
+                QuinlanTremaine1990Order12,
+                Ephemeris<Barycentric>::NewtonianMotionEquation>(),
+            /*step=*/10 * Minute));
+    EXPECT_OK(ephemeris_->Prolong(t0_));
+    navigation_frame_ = std::make_unique<TestNavigationFrame>(
+        ephemeris_.get(),
+        ephemeris_->bodies().back());
+    flight_plan_ = std::make_unique<FlightPlan>(
+        /*initial_mass=*/1 * Kilogram,
+        /*initial_time=*/t0_,
+        /*initial_degrees_of_freedom=*/DegreesOfFreedom<Barycentric>(
+            Barycentric::origin +
+                Displacement<Barycentric>({1 * Metre, 0 * Metre, 0 * Metre}),
+            Velocity<Barycentric>({0 * Metre / Second,
+                                   1 * Metre / Second,
+                                   0 * Metre / Second})),
+        /*desired_final_time=*/t0_ + 10 * Second,
+        ephemeris_.get(),
+        Ephemeris<Barycentric>::AdaptiveStepParameters(
+            EmbeddedExplicitRungeKuttaNyströmIntegrator<
+                DormandالمكاوىPrince1986RKN434FM,
+                Ephemeris<Barycentric>::NewtonianMotionEquation>(),
+            /*max_steps=*/1000,
+            /*length_integration_tolerance=*/1 * Milli(Metre),
+            /*speed_integration_tolerance=*/1 * Milli(Metre) / Second),
+        Ephemeris<Barycentric>::GeneralizedAdaptiveStepParameters(
+            EmbeddedExplicitGeneralizedRungeKuttaNyströmIntegrator<
+                Fine1987RKNG34,
+                Ephemeris<Barycentric>::GeneralizedNewtonianMotionEquation>(),
+            /*max_steps=*/1000,
+            /*length_integration_tolerance=*/1 * Milli(Metre),
+            /*speed_integration_tolerance=*/1 * Milli(Metre) / Second));
+  }
+
+  NavigationManœuvre::Burn MakeBurn(Instant const& initial_time,
+                                    Speed const& Δv) {
+    NavigationManœuvre::Intensity intensity;
+    intensity.Δv = Velocity<Frenet<Navigation>>({Δv,
+                                                 0 * Metre / Second,
+                                                 0 * Metre / Second});
+    NavigationManœuvre::Timing timing;
+    timing.initial_time = initial_time;
+    return {intensity,
+            timing,
+            /*thrust=*/1 * Newton,
+            /*specific_impulse=*/1 * Newton * Second / Kilogram,
+            make_not_null_unique<TestNavigationFrame>(*navigation_frame_),
+            /*is_inertially_fixed=*/true};
+  }
+
+  std::shared_ptr<IndexedCoast const> GetFirstCoast() {
+    return cache_.Get(*flight_plan_,
+                      /*segment_index=*/0,
+                      /*central_body_index=*/0,
+                      *navigation_frame_);
+  }
+
+  // Checks that |coast| matches the first coast of |flight_plan_|.
+  void CheckFirstCoast(IndexedCoast const& coast) {
+    std::vector<Instant> expected_times;
+    for (auto const& [time, _] : *flight_plan_->GetSegment(0)) {
+      expected_times.push_back(time);
+    }
+    EXPECT_THAT(coast.times, ElementsAreArray(expected_times));
+    EXPECT_EQ(coast.times.size(), coast.positions.size());
+    EXPECT_EQ(coast.times.front(), coast.trajectory.front().time);
+    EXPECT_EQ(coast.times.back(), coast.trajectory.back().time);
+  }
+
+  Instant const t0_ = J2000;
+  std::unique_ptr<TestNavigationFrame> navigation_frame_;
+  std::unique_ptr<Ephemeris<Barycentric>> ephemeris_;
+  std::unique_ptr<FlightPlan> flight_plan_;
+  IndexedCoastCache cache_;
+};
+
+TEST_F(IndexedCoastCacheTest, RebuiltOnEdit) {
+  auto const coast = GetFirstCoast();
+  CheckFirstCoast(*coast);
+  EXPECT_EQ(t0_ + 10 * Second, coast->times.back());
+
+  // Same flight plan, same coast.
+  EXPECT_THAT(GetFirstCoast(), Eq(coast));
+
+  // Changing the final time changes the generation and rebuilds the coast.
+  EXPECT_OK(flight_plan_->SetDesiredFinalTime(t0_ + 20 * Second));
+  auto const extended_coast = GetFirstCoast();
+  EXPECT_THAT(extended_coast, Not(Eq(coast)));
+  CheckFirstCoast(*extended_coast);
+  EXPECT_EQ(t0_ + 20 * Second, extended_coast->times.back());
+  EXPECT_THAT(GetFirstCoast(), Eq(extended_coast));
+
+  // Inserting a burn cuts the first coast at its start.
+  EXPECT_OK(flight_plan_->Insert(MakeBurn(t0_ + 5 * Second,
+                                          1 * Metre / Second),
+                                 /*index=*/0));
+  auto const cut_coast = GetFirstCoast();
+  EXPECT_THAT(cut_coast, Not(Eq(extended_coast)));
+  CheckFirstCoast(*cut_coast);
+  EXPECT_EQ(t0_ + 5 * Second, cut_coast->times.back());
+
+  // Replacing the burn with one that starts earlier cuts it further.
+  EXPECT_OK(flight_plan_->Replace(MakeBurn(t0_ + 3 * Second,
+                                           1 * Metre / Second),
+                                  /*index=*/0));
+  auto const replaced_coast = GetFirstCoast();
+  EXPECT_THAT(replaced_coast, Not(Eq(cut_coast)));
+  CheckFirstCoast(*replaced_coast);
+  EXPECT_EQ(t0_ + 3 * Second, replaced_coast->times.back());
+  EXPECT_THAT(GetFirstCoast(), Eq(replaced_coast));
+}
+
+}  // namespace ksp_plugin
+}  // namespace principia
@@ -2,6 +2,7 @@
 
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "astronomy/frames.hpp"
 #include "base/not_null.hpp"
@@ -13,6 +14,8 @@
 #include "ksp_plugin_test/fake_plugin.hpp"
 #include "physics/solar_system.hpp"
 #include "quantities/elementary_functions.hpp"
+#include "quantities/named_quantities.hpp"
+#include "quantities/quantities.hpp"
 #include "quantities/si.hpp"
 #include "testing_utilities/approximate_quantity.hpp"
 #include "testing_utilities/componentwise.hpp"
@@ -27,6 +30,7 @@ using ::testing::AllOf;
 using ::testing::Eq;
 using ::testing::Gt;
 using ::testing::Lt;
+using ::testing::Not;
 using namespace principia::astronomy::_frames;
 using namespace principia::base::_not_null;
 using namespace principia::ksp_plugin::_frames;
@@ -35,6 +39,8 @@ using namespace principia::ksp_plugin::_vessel;
 using namespace principia::ksp_plugin_test::_fake_plugin;
 using namespace principia::physics::_solar_system;
 using namespace principia::quantities::_elementary_functions;
+using namespace principia::quantities::_named_quantities;
+using namespace principia::quantities::_quantities;
 using namespace principia::quantities::_si;
 using namespace principia::testing_utilities::_approximate_quantity;
 using namespace principia::testing_utilities::_componentwise;
@@ -78,6 +84,91 @@ class InterfaceExternalTest : public ::testing::Test {
   Vessel* vessel_;
 };
 
+TEST_F(InterfaceExternalTest, FlowFreefall) {
+  auto const& earth = *plugin_.GetCelestial(SolarSystemFactory::Earth).body();
+  GravitationalParameter const μ = earth.gravitational_parameter();
+  Length const r = 6783 * Kilo(Metre);
+  Speed const v = Sqrt(μ / r);
+  Time const period = 2 * π * Sqrt(Pow<3>(r) / μ);
+  double const t_initial = ToGameTime(plugin_, plugin_.CurrentTime());
+  double const t_final = t_initial + period / Second;
+  QP const initial{{r / Metre, 0, 0}, {0, v / (Metre / Second), 0}};
+
+  // After one period of a circular orbit, we are back near our starting point;
+  // the perturbations of the Moon, the Sun, and the geopotential make this
+  // approximate.
+  QP result;
+  auto const* status = principia__ExternalFlowFreefall(
+      &plugin_,
+      SolarSystemFactory::Earth,
+      initial,
+      t_initial,
+      t_final,
+      &result);
+  EXPECT_THAT(*status, IsOk());
+  auto const final_degrees_of_freedom =
+      FromQP<RelativeDegreesOfFreedom<World>>(result);
+  auto const initial_degrees_of_freedom =
+      FromQP<RelativeDegreesOfFreedom<World>>(initial);
+  EXPECT_THAT((final_degrees_of_freedom.displacement() -
+               initial_degrees_of_freedom.displacement()).Norm(),
+              Lt(50 * Kilo(Metre)));
+  EXPECT_THAT((final_degrees_of_freedom.velocity() -
+               initial_degrees_of_freedom.velocity()).Norm(),
+              Lt(50 * Metre / Second));
+
+  // The batched version gives the same results for identical initial states,
+  // and doesn't touch the elements past |final_count|.
+  QP const* const batch_initial[] = {&initial, &initial, &initial, nullptr};
+  QP const unset{{-1, -1, -1}, {-1, -1, -1}};
+  std::vector<QP> batch_final(4, unset);
+  int final_count;
+  status = principia__ExternalFlowFreefalls(
+      &plugin_,
+      SolarSystemFactory::Earth,
+      t_initial,
+      t_final,
+      batch_initial,
+      batch_final.data(),
+      batch_final.size(),
+      &final_count);
+  EXPECT_THAT(*status, IsOk());
+  EXPECT_EQ(3, final_count);
+  for (int i = 0; i < final_count; ++i) {
+    EXPECT_EQ(result.q.x, batch_final[i].q.x);
+    EXPECT_EQ(result.q.y, batch_final[i].q.y);
+    EXPECT_EQ(result.q.z, batch_final[i].q.z);
+    EXPECT_EQ(result.p.x, batch_final[i].p.x);
+    EXPECT_EQ(result.p.y, batch_final[i].p.y);
+    EXPECT_EQ(result.p.z, batch_final[i].p.z);
+  }
+  EXPECT_EQ(unset.q.x, batch_final[3].q.x);
+
+  // The output buffer must be large enough for the results.
+  status = principia__ExternalFlowFreefalls(
+      &plugin_,
+      SolarSystemFactory::Earth,
+      t_initial,
+      t_final,
+      batch_initial,
+      batch_final.data(),
+      /*world_body_centred_final_degrees_of_freedom_size=*/2,
+      &final_count);
+  EXPECT_EQ(static_cast<int>(absl::StatusCode::kInvalidArgument),
+            status->error);
+  EXPECT_EQ(0, final_count);
+
+  // Flowing backwards is an error.
+  status = principia__ExternalFlowFreefall(
+      &plugin_,
+      SolarSystemFactory::Earth,
+      initial,
+      t_final,
+      t_initial,
+      &result);
+  EXPECT_THAT(*status, Not(IsOk()));
+}
+
 TEST_F(InterfaceExternalTest, GetNearestPlannedCoastDegreesOfFreedom) {
   plugin_.CreateFlightPlan(
       vessel_guid, plugin_.CurrentTime() + 6 * Hour, 1 * Tonne);
@@ -125,6 +216,28 @@ TEST_F(InterfaceExternalTest, GetNearestPlannedCoastDegreesOfFreedom) {
                                   IsNear(-4.9_(1) * Kilo(Metre) / Second),
                                   AllOf(Gt(-1 * Centi(Metre) / Second),
                                         Lt(1 * Centi(Metre) / Second)))));
+
+  // A second call uses the cached coast and gives the same result.
+  QP cached_result;
+  auto const* const cached_status =
+      principia__ExternalGetNearestPlannedCoastDegreesOfFreedom(
+          &plugin_,
+          SolarSystemFactory::Earth,
+          vessel_guid,
+          /*manoeuvre_index=*/0,
+          /*reference_position=*/
+          ToXYZ(to_world(Displacement<Barycentric>(
+                             {-100'000 * Kilo(Metre), 0 * Metre, 0 * Metre}))
+                    .coordinates() /
+                Metre),
+          &cached_result);
+  EXPECT_THAT(*cached_status, IsOk());
+  EXPECT_EQ(result.q.x, cached_result.q.x);
+  EXPECT_EQ(result.q.y, cached_result.q.y);
+  EXPECT_EQ(result.q.z, cached_result.q.z);
+  EXPECT_EQ(result.p.x, cached_result.p.x);
+  EXPECT_EQ(result.p.y, cached_result.p.y);
+  EXPECT_EQ(result.p.z, cached_result.p.z);
 }
 
 TEST_F(InterfaceExternalTest, Geopotential) {
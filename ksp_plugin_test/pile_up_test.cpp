@@ -1,6 +1,8 @@
 #include "ksp_plugin/pile_up.hpp"
 
+#include <iterator>
 #include <limits>
+#include <list>
 #include <map>
 #include <memory>
 #include <utility>
@@ -9,8 +11,10 @@
 #include "absl/status/status.h"
 #include "astronomy/epoch.hpp"
 #include "base/not_null.hpp"
+#include "base/thread_pool.hpp"
 #include "geometry/frame.hpp"
 #include "geometry/grassmann.hpp"
+#include "geometry/instant.hpp"
 #include "geometry/r3_element.hpp"
 #include "geometry/r3x3_matrix.hpp"
 #include "geometry/rotation.hpp"
@@ -56,8 +60,10 @@ using ::testing::Return;
 using ::testing::_;
 using namespace principia::astronomy::_epoch;
 using namespace principia::base::_not_null;
+using namespace principia::base::_thread_pool;
 using namespace principia::geometry::_frame;
 using namespace principia::geometry::_grassmann;
+using namespace principia::geometry::_instant;
 using namespace principia::geometry::_r3_element;
 using namespace principia::geometry::_r3x3_matrix;
 using namespace principia::geometry::_rotation;
@@ -652,6 +658,181 @@ TEST_F(PileUpTest, MidStepIntrinsicForce) {
       AlmostEquals(old_velocity + 0.5 * fixed_step * a, 1));
 }
 
+TEST_F(PileUpTest, AdvanceHistoriesInBulk) {
+  // A tiny body very far, as above.
+  std::vector<not_null<std::unique_ptr<MassiveBody const>>> bodies;
+  bodies.emplace_back(make_not_null_unique<MassiveBody>(1 * Kilogram));
+  std::vector<DegreesOfFreedom<Barycentric>> initial_state{
+      DegreesOfFreedom<Barycentric>{
+          Barycentric::origin +
+              Displacement<Barycentric>(
+                  {std::pow(2, 100) * Metre, 0 * Metre, 0 * Metre}),
+          Barycentric::unmoving}};
+  Ephemeris<Barycentric> ephemeris{
+      std::move(bodies),
+      initial_state,
+      /*initial_time=*/J2000,
+      /*accuracy_parameters=*/{/*fitting_tolerance=*/1 * Metre,
+                               /*geopotential_tolerance=*/0x1p-24},
+      Ephemeris<Barycentric>::FixedStepParameters{
+          SymplecticRungeKuttaNyströmIntegrator<
+              BlanesMoan2002SRKN6B,
+              Ephemeris<Barycentric>::NewtonianMotionEquation>(),
+          1 * Second}};
+  Ephemeris<Barycentric>::FixedStepParameters const bulk_parameters{
+      SymplecticRungeKuttaNyströmIntegrator<
+          BlanesMoan2002SRKN6B,
+          Ephemeris<Barycentric>::NewtonianMotionEquation>(),
+      10 * Second};
+
+  EXPECT_CALL(deletion_callback_, Call()).Times(2);
+  TestablePileUp pile_up1({&p1_}, J2000,
+                          DefaultPsychohistoryParameters(),
+                          DefaultHistoryParameters(),
+                          &ephemeris,
+                          deletion_callback_.AsStdFunction());
+  TestablePileUp pile_up2({&p2_}, J2000 + 3 * Second,
+                          DefaultPsychohistoryParameters(),
+                          DefaultHistoryParameters(),
+                          &ephemeris,
+                          deletion_callback_.AsStdFunction());
+
+  // The histories end at different times, so the first pile-up catches up with
+  // the second one, and then they are advanced together.
+  PileUp::AdvanceHistoriesInBulk(
+      {&pile_up1, &pile_up2}, J2000 + 25 * Second, bulk_parameters);
+  EXPECT_OK(pile_up1.DeformAndAdvanceTime(J2000 + 25 * Second));
+  EXPECT_OK(pile_up2.DeformAndAdvanceTime(J2000 + 25 * Second));
+  for (Part* const part : {&p1_, &p2_}) {
+    EXPECT_EQ(J2000 + 23 * Second, std::prev(part->history_end())->time);
+    EXPECT_EQ(J2000 + 25 * Second,
+              std::prev(part->psychohistory_end())->time);
+    part->ClearHistory();
+  }
+
+  // Not enough time for a step of the ensemble, so the psychohistories are
+  // prolonged.
+  PileUp::AdvanceHistoriesInBulk(
+      {&pile_up1, &pile_up2}, J2000 + 27 * Second, bulk_parameters);
+  EXPECT_OK(pile_up1.DeformAndAdvanceTime(J2000 + 27 * Second));
+  EXPECT_OK(pile_up2.DeformAndAdvanceTime(J2000 + 27 * Second));
+  std::vector<Instant> psychohistory_times;
+  for (auto const& [time, degrees_of_freedom] : *pile_up1.psychohistory()) {
+    psychohistory_times.push_back(time);
+  }
+  EXPECT_THAT(psychohistory_times,
+              ElementsAre(J2000 + 23 * Second,
+                          J2000 + 25 * Second,
+                          J2000 + 27 * Second));
+
+  // The parts were cleared, so they get the entire psychohistory again, not
+  // just its prolongation.
+  for (Part* const part : {&p1_, &p2_}) {
+    EXPECT_EQ(part->history_begin(), part->history_end());
+    std::vector<Instant> part_psychohistory_times;
+    for (auto it = part->psychohistory_begin();
+         it != part->psychohistory_end();
+         ++it) {
+      part_psychohistory_times.push_back(it->time);
+    }
+    EXPECT_THAT(part_psychohistory_times,
+                ElementsAre(J2000 + 25 * Second, J2000 + 27 * Second));
+  }
+}
+
+// Checks that updating the parts in parallel yields the same results as
+// updating them serially.
+TEST_F(PileUpTest, ParallelParts) {
+  // A tiny body very far, as above.
+  std::vector<not_null<std::unique_ptr<MassiveBody const>>> bodies;
+  bodies.emplace_back(make_not_null_unique<MassiveBody>(1 * Kilogram));
+  std::vector<DegreesOfFreedom<Barycentric>> initial_state{
+      DegreesOfFreedom<Barycentric>{
+          Barycentric::origin +
+              Displacement<Barycentric>(
+                  {std::pow(2, 100) * Metre, 0 * Metre, 0 * Metre}),
+          Barycentric::unmoving}};
+  Ephemeris<Barycentric> ephemeris{
+      std::move(bodies),
+      initial_state,
+      /*initial_time=*/J2000,
+      /*accuracy_parameters=*/{/*fitting_tolerance=*/1 * Metre,
+                               /*geopotential_tolerance=*/0x1p-24},
+      Ephemeris<Barycentric>::FixedStepParameters{
+          SymplecticRungeKuttaNyströmIntegrator<
+              BlanesMoan2002SRKN6B,
+              Ephemeris<Barycentric>::NewtonianMotionEquation>(),
+          1 * Second}};
+
+  // Enough parts for several chunks, the last one incomplete.
+  int const number_of_parts = 100;
+  std::list<not_null<Part*>> serial_parts;
+  std::list<not_null<Part*>> parallel_parts;
+  std::vector<not_null<std::unique_ptr<Part>>> parts;
+  for (int i = 0; i < 2 * number_of_parts; ++i) {
+    int const j = i % number_of_parts;
+    DegreesOfFreedom<Barycentric> const degrees_of_freedom(
+        Barycentric::origin +
+            Displacement<Barycentric>({j * Metre, 2 * j * Metre, 3 * Metre}),
+        Velocity<Barycentric>({10 * Metre / Second,
+                               j * Metre / Second,
+                               -j * Metre / Second}));
+    parts.push_back(make_not_null_unique<Part>(
+        i,
+        "part",
+        mass1_,
+        EccentricPart::origin,
+        inertia_tensor1_,
+        RigidMotion<EccentricPart, Barycentric>::MakeNonRotatingMotion(
+            degrees_of_freedom),
+        /*deletion_callback=*/nullptr));
+    (i < number_of_parts ? serial_parts : parallel_parts)
+        .push_back(parts.back().get());
+  }
+
+  EXPECT_CALL(deletion_callback_, Call()).Times(2);
+  TestablePileUp serial_pile_up(serial_parts, J2000,
+                                DefaultPsychohistoryParameters(),
+                                DefaultHistoryParameters(),
+                                &ephemeris,
+                                deletion_callback_.AsStdFunction());
+  TestablePileUp parallel_pile_up(parallel_parts, J2000,
+                                  DefaultPsychohistoryParameters(),
+                                  DefaultHistoryParameters(),
+                                  &ephemeris,
+                                  deletion_callback_.AsStdFunction());
+
+  ThreadPool<absl::Status> thread_pool(/*pool_size=*/4);
+  EXPECT_OK(serial_pile_up.DeformAndAdvanceTime(J2000 + 25 * Second));
+  // Run on the pool, as in the plugin.
+  EXPECT_OK(thread_pool
+                .Add([&parallel_pile_up, &thread_pool]() {
+                  return parallel_pile_up.DeformAndAdvanceTime(
+                      J2000 + 25 * Second, &thread_pool);
+                })
+                .get());
+
+  for (int i = 0; i < number_of_parts; ++i) {
+    Part& serial_part = *parts[i];
+    Part& parallel_part = *parts[i + number_of_parts];
+    EXPECT_EQ(serial_part.rigid_motion()({RigidPart::origin,
+                                          RigidPart::unmoving}),
+              parallel_part.rigid_motion()({RigidPart::origin,
+                                            RigidPart::unmoving}));
+    auto parallel_it = parallel_part.history_begin();
+    for (auto serial_it = serial_part.history_begin();
+         serial_it != serial_part.psychohistory_end();
+         ++serial_it, ++parallel_it) {
+      ASSERT_NE(parallel_part.psychohistory_end(), parallel_it);
+      EXPECT_EQ(serial_it->time, parallel_it->time);
+      EXPECT_EQ(serial_it->degrees_of_freedom, parallel_it->degrees_of_freedom);
+    }
+    EXPECT_EQ(parallel_part.psychohistory_end(), parallel_it);
+    EXPECT_EQ(J2000 + 25 * Second,
+              std::prev(parallel_part.psychohistory_end())->time);
+  }
+}
+
 TEST_F(PileUpTest, Serialization) {
   MockEphemeris<Barycentric> ephemeris;
   p1_.apply_intrinsic_force(
@@ -13,6 +13,7 @@
 #include "absl/status/status.h"
 #include "astronomy/frames.hpp"
 #include "astronomy/time_scales.hpp"
+#include "base/disjoint_sets.hpp"
 #include "base/map_util.hpp"
 #include "base/not_null.hpp"
 #include "base/serialization.hpp"
@@ -32,6 +33,9 @@
 #include "integrators/symmetric_linear_multistep_integrator.hpp"
 #include "ksp_plugin/frames.hpp"
 #include "ksp_plugin/identification.hpp"
+#include "ksp_plugin/part.hpp"
+#include "ksp_plugin/part_subsets.hpp"  // 🧙 For Subset<Part>.
+#include "ksp_plugin/pile_up.hpp"
 #include "physics/continuous_trajectory.hpp"
 #include "physics/degrees_of_freedom.hpp"
 #include "physics/ephemeris.hpp"
@@ -79,6 +83,7 @@ using ::testing::StrictMock;
 using ::testing::_;
 using namespace principia::astronomy::_frames;
 using namespace principia::astronomy::_time_scales;
+using namespace principia::base::_disjoint_sets;
 using namespace principia::base::_map_util;
 using namespace principia::base::_not_null;
 using namespace principia::base::_serialization;
@@ -96,6 +101,8 @@ using namespace principia::integrators::_ordinary_differential_equations;
 using namespace principia::integrators::_symmetric_linear_multistep_integrator;
 using namespace principia::ksp_plugin::_frames;
 using namespace principia::ksp_plugin::_identification;
+using namespace principia::ksp_plugin::_part;
+using namespace principia::ksp_plugin::_pile_up;
 using namespace principia::ksp_plugin::_plugin;
 using namespace principia::physics::_continuous_trajectory;
 using namespace principia::physics::_degrees_of_freedom;
@@ -790,6 +797,60 @@ TEST_F(PluginTest, VesselInsertionAtInitialization) {
                     AlmostEquals(satellite_initial_velocity_, 11, 17)));
 }
 
+TEST_F(PluginTest, UnloadedPileUpsAreNotRecollected) {
+  GUID const guid = "Test Satellite";
+  PartId const part_id1 = 666;
+  PartId const part_id2 = 667;
+  InsertAllSolarSystemBodies();
+  plugin_->EndInitialization();
+  EXPECT_CALL(plugin_->mock_ephemeris(), Prolong(_, _)).Times(AnyNumber());
+  bool inserted;
+  plugin_->InsertOrKeepVessel(guid,
+                              "v" + guid,
+                              SolarSystemFactory::Earth,
+                              /*loaded=*/false,
+                              inserted);
+  for (PartId const part_id : {part_id1, part_id2}) {
+    plugin_->InsertUnloadedPart(
+        part_id,
+        "part",
+        guid,
+        RelativeDegreesOfFreedom<AliceSun>(satellite_initial_displacement_,
+                                           satellite_initial_velocity_));
+  }
+  plugin_->PrepareToReportCollisions();
+  plugin_->FreeVesselsAndPartsAndCollectPileUps(20 * Milli(Second));
+  Part& part1 = *plugin_->GetVessel(guid)->part(part_id1);
+  Part& part2 = *plugin_->GetVessel(guid)->part(part_id2);
+  PileUp const* const pile_up = part1.containing_pile_up();
+  ASSERT_NE(nullptr, pile_up);
+  EXPECT_EQ(pile_up, part2.containing_pile_up());
+  EXPECT_TRUE(Subset<Part>::Find(part1) == Subset<Part>::Find(part2));
+
+  // The vessel is unloaded and unchanged, so its parts are not made singletons
+  // and its pile-up is left alone.
+  plugin_->InsertOrKeepVessel(guid,
+                              "v" + guid,
+                              SolarSystemFactory::Earth,
+                              /*loaded=*/false,
+                              inserted);
+  EXPECT_FALSE(inserted);
+  plugin_->PrepareToReportCollisions();
+  EXPECT_TRUE(Subset<Part>::Find(part1) == Subset<Part>::Find(part2));
+  plugin_->FreeVesselsAndPartsAndCollectPileUps(20 * Milli(Second));
+  EXPECT_EQ(pile_up, part1.containing_pile_up());
+  EXPECT_EQ(pile_up, part2.containing_pile_up());
+
+  // Once the vessel is loaded, its parts are made singletons again.
+  plugin_->InsertOrKeepVessel(guid,
+                              "v" + guid,
+                              SolarSystemFactory::Earth,
+                              /*loaded=*/true,
+                              inserted);
+  plugin_->PrepareToReportCollisions();
+  EXPECT_TRUE(Subset<Part>::Find(part1) != Subset<Part>::Find(part2));
+}
+
 TEST_F(PluginTest, UpdateCelestialHierarchy) {
   InsertAllSolarSystemBodies();
   plugin_->EndInitialization();
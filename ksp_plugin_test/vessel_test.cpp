@@ -53,6 +53,7 @@ using ::testing::ElementsAre;
 using ::testing::Ge;
 using ::testing::Le;
 using ::testing::MockFunction;
+using ::testing::Property;
 using ::testing::Return;
 using ::testing::ReturnRef;
 using ::testing::_;
@@ -382,6 +383,79 @@ TEST_F(VesselTest, PredictBeyondTheInfinite) {
   }
 }
 
+TEST_F(VesselTest, PredictionLevelOfDetail) {
+  EXPECT_CALL(ephemeris_, t_min_locked())
+      .WillRepeatedly(Return(t0_));
+  EXPECT_CALL(ephemeris_, t_max())
+      .WillRepeatedly(Return(t0_ + 2 * Second));
+
+  Length const length_integration_tolerance =
+      DefaultPredictionParameters().length_integration_tolerance();
+  vessel_.set_prediction_level_of_detail(Vessel::PredictionLevelOfDetail{
+      .full_accuracy_duration = 1 * Second,
+      .tolerance_multiplier = 10,
+      .downsampling_parameters = DefaultDownsamplingParameters()});
+
+  // The call to fill the prognostication at full accuracy.
+  auto const expected_full_accuracy_prediction = NewLinearTrajectoryTimeline(
+      Barycentre({p1_dof_, p2_dof_}, {mass1_, mass2_}),
+      /*Δt=*/0.5 * Second,
+      /*t1=*/t0_,
+      /*t2=*/t0_ + 1 * Second);
+  EXPECT_CALL(ephemeris_,
+              FlowWithAdaptiveStep(
+                  _, _,
+                  t0_ + 1 * Second,
+                  Property(&Ephemeris<Barycentric>::AdaptiveStepParameters::
+                               length_integration_tolerance,
+                           length_integration_tolerance),
+                  _))
+      .WillRepeatedly(DoAll(
+          AppendPointsToDiscreteTrajectory(&expected_full_accuracy_prediction),
+          Return(absl::OkStatus())));
+
+  // The call to fill the prognostication at reduced accuracy until t_max.
+  auto const expected_reduced_accuracy_prediction = NewLinearTrajectoryTimeline(
+      Barycentre({p1_dof_, p2_dof_}, {mass1_, mass2_}),
+      /*Δt=*/0.5 * Second,
+      /*t1=*/t0_ + 1 * Second,
+      /*t2=*/t0_ + 2 * Second);
+  EXPECT_CALL(ephemeris_,
+              FlowWithAdaptiveStep(
+                  _, _,
+                  t0_ + 2 * Second,
+                  Property(&Ephemeris<Barycentric>::AdaptiveStepParameters::
+                               length_integration_tolerance,
+                           10 * length_integration_tolerance),
+                  _))
+      .WillRepeatedly(DoAll(
+          AppendPointsToDiscreteTrajectory(
+              &expected_reduced_accuracy_prediction),
+          Return(absl::OkStatus())));
+
+  // The call to extend the exphemeris.
+  EXPECT_CALL(
+      ephemeris_,
+      FlowWithAdaptiveStep(_, _, InfiniteFuture, _, _))
+      .WillRepeatedly(Return(absl::OkStatus()));
+
+  vessel_.CreateTrajectoryIfNeeded(t0_);
+  // Polling for the integration to happen.
+  int count = 0;
+  do {
+    vessel_.RefreshPrediction();
+    using namespace std::chrono_literals;
+    std::this_thread::sleep_for(100ms);
+    ++count;
+    CHECK_LT(count, 1000);
+  } while (vessel_.prediction()->back().time == t0_);
+
+  EXPECT_EQ(4, vessel_.prediction()->size());
+  EXPECT_EQ(t0_ + 1.5 * Second, vessel_.prediction()->back().time);
+  // The last point computed at full accuracy.
+  EXPECT_EQ(t0_ + 0.5 * Second, vessel_.prediction_reduced_accuracy_time());
+}
+
 TEST_F(VesselTest, FlightPlan) {
   EXPECT_CALL(ephemeris_, t_min())
       .WillRepeatedly(Return(t0_));
@@ -828,17 +902,28 @@ TEST_F(VesselTest, SerializationSuccess) {
                            10 * Kilogram,
                            DefaultPredictionParameters(),
                            DefaultBurnParameters());
+  vessel_.set_prediction_level_of_detail(Vessel::PredictionLevelOfDetail{
+      .full_accuracy_duration = 1 * Second,
+      .tolerance_multiplier = 10,
+      .downsampling_parameters = DefaultDownsamplingParameters()});
+  vessel_.set_debris(true);
 
   serialization::Vessel message;
   vessel_.WriteToMessage(&message,
                          serialization_index_for_pile_up.AsStdFunction());
   EXPECT_TRUE(message.has_history());
   EXPECT_FALSE(message.flight_plans().empty());
+  EXPECT_TRUE(message.has_prediction_level_of_detail());
 
   EXPECT_CALL(ephemeris_, Prolong(_, _)).Times(2);
   auto const v = Vessel::ReadFromMessage(
       message, &celestial_, &ephemeris_, /*deletion_callback=*/nullptr);
   EXPECT_TRUE(v->has_flight_plan());
+  ASSERT_TRUE(v->prediction_level_of_detail().has_value());
+  EXPECT_EQ(1 * Second,
+            v->prediction_level_of_detail()->full_accuracy_duration);
+  EXPECT_EQ(10, v->prediction_level_of_detail()->tolerance_multiplier);
+  EXPECT_TRUE(v->is_debris());
   v->ReadFlightPlanFromMessage();
 
   serialization::Vessel second_message;
@@ -1,7 +1,10 @@
 #include "numerics/elliptic_functions.hpp"
 
 #include <cmath>
+#include <cstdint>
+#include <limits>
 #include <tuple>
+#include <vector>
 
 #include "glog/logging.h"
 #include "numerics/elliptic_integrals.hpp"
@@ -25,6 +28,27 @@ namespace {
 
 constexpr Angle k_over_2_lower_bound = π / 4.0 * Radian;
 
+// Remembers K(m) for the last value of |mc|, so that K(m) is computed only once
+// for each run of equal values of |mc| in the batch functions.
+class EllipticKCache {
+ public:
+  Angle const& operator()(double mc);
+
+ private:
+  // NaN is not equal to anything, so the first call computes K(m).
+  double mc_ = std::numeric_limits<double>::quiet_NaN();
+  Angle k_;
+};
+
+Angle JacobiAmplitude(Angle const& u, double mc, EllipticKCache& elliptic_k);
+
+void JacobiSNCNDN(Angle const& u,
+                  double mc,
+                  EllipticKCache& elliptic_k,
+                  double& s,
+                  double& c,
+                  double& d);
+
 void JacobiSNCNDNReduced(Angle const& u,
                          double mc,
                          double& s,
@@ -199,9 +223,18 @@ void JacobiSNCNDNWithK(Angle const& u,
     s = -s;
   }
 }
-}  // namespace
 
-Angle JacobiAmplitude(Angle const& u, double mc) {
+Angle const& EllipticKCache::operator()(double const mc) {
+  if (mc != mc_) {
+    mc_ = mc;
+    k_ = EllipticK(mc);
+  }
+  return k_;
+}
+
+Angle JacobiAmplitude(Angle const& u,
+                      double const mc,
+                      EllipticKCache& elliptic_k) {
   DCHECK_LE(0, mc);
   DCHECK_GE(1, mc);
   double s;
@@ -226,13 +259,39 @@ Angle JacobiAmplitude(Angle const& u, double mc) {
     // to the range [-π/2, π/2].  We avoid the branch cut, and any inaccuracy in
     // the rounding has the innocuous effect of causing the ArcTan to go a bit
     // beyond -π/2 or π/2.
-    Angle const k = EllipticK(mc);
+    Angle const& k = elliptic_k(mc);
     n = std::nearbyint(u / (2.0 * k));
     JacobiSNCNDNWithK(u - 2.0 * n * k, mc, k, s, c, d);
   }
   return n * π * Radian + ArcTan(s, c);
 }
 
+void JacobiSNCNDN(Angle const& u,
+                  double const mc,
+                  EllipticKCache& elliptic_k,
+                  double& s,
+                  double& c,
+                  double& d) {
+  DCHECK_LE(0, mc);
+  DCHECK_GE(1, mc);
+  Angle const abs_u = Abs(u);
+  if (abs_u < k_over_2_lower_bound) {
+    JacobiSNCNDNReduced(abs_u, mc, s, c, d);
+    if (u < Angle()) {
+      s = -s;
+    }
+  } else {
+    JacobiSNCNDNWithK(u, mc, elliptic_k(mc), s, c, d);
+  }
+}
+
+}  // namespace
+
+Angle JacobiAmplitude(Angle const& u, double const mc) {
+  EllipticKCache elliptic_k;
+  return JacobiAmplitude(u, mc, elliptic_k);
+}
+
 // Double precision subroutine to compute three Jacobian elliptic functions
 // simultaneously
 //
@@ -254,17 +313,74 @@ void JacobiSNCNDN(Angle const& u,
                   double& s,
                   double& c,
                   double& d) {
-  DCHECK_LE(0, mc);
-  DCHECK_GE(1, mc);
-  Angle const abs_u = Abs(u);
-  if (abs_u < k_over_2_lower_bound) {
-    JacobiSNCNDNReduced(abs_u, mc, s, c, d);
-    if (u < Angle()) {
-      s = -s;
+  EllipticKCache elliptic_k;
+  JacobiSNCNDN(u, mc, elliptic_k, s, c, d);
+}
+
+void JacobiAmplitude(std::vector<Angle> const& u,
+                     std::vector<double> const& mc,
+                     std::vector<Angle>& am) {
+  CHECK_EQ(u.size(), mc.size());
+  am.resize(u.size());
+  EllipticKCache elliptic_k;
+  for (std::int64_t i = 0; i < u.size(); ++i) {
+    am[i] = JacobiAmplitude(u[i], mc[i], elliptic_k);
+  }
+}
+
+void JacobiSNCNDN(std::vector<Angle> const& u,
+                  std::vector<double> const& mc,
+                  std::vector<double>& s,
+                  std::vector<double>& c,
+                  std::vector<double>& d) {
+  CHECK_EQ(u.size(), mc.size());
+  s.resize(u.size());
+  c.resize(u.size());
+  d.resize(u.size());
+  EllipticKCache elliptic_k;
+  for (std::int64_t i = 0; i < u.size(); ++i) {
+    JacobiSNCNDN(u[i], mc[i], elliptic_k, s[i], c[i], d[i]);
+  }
+}
+
+void JacobiSNCNDNAmplitude(std::vector<Angle> const& u,
+                           std::vector<double> const& mc,
+                           std::vector<double>& s,
+                           std::vector<double>& c,
+                           std::vector<double>& d,
+                           std::vector<Angle>& am) {
+  CHECK_EQ(u.size(), mc.size());
+  s.resize(u.size());
+  c.resize(u.size());
+  d.resize(u.size());
+  am.resize(u.size());
+  EllipticKCache elliptic_k;
+  for (std::int64_t i = 0; i < u.size(); ++i) {
+    DCHECK_LE(0, mc[i]);
+    DCHECK_GE(1, mc[i]);
+    double& sᵢ = s[i];
+    double& cᵢ = c[i];
+    double& dᵢ = d[i];
+    Angle const abs_u = Abs(u[i]);
+    if (abs_u < k_over_2_lower_bound) {
+      JacobiSNCNDNReduced(abs_u, mc[i], sᵢ, cᵢ, dᵢ);
+      if (u[i] < Angle()) {
+        sᵢ = -sᵢ;
+      }
+      am[i] = ArcTan(sᵢ, cᵢ);
+    } else {
+      // Same reduction as in |JacobiAmplitude|.  Since sn(u + 2K) = -sn(u),
+      // cn(u + 2K) = -cn(u) and dn(u + 2K) = dn(u), the functions at u follow
+      // from those at the reduced argument.
+      Angle const& k = elliptic_k(mc[i]);
+      double const n = std::nearbyint(u[i] / (2.0 * k));
+      JacobiSNCNDNWithK(u[i] - 2.0 * n * k, mc[i], k, sᵢ, cᵢ, dᵢ);
+      am[i] = n * π * Radian + ArcTan(sᵢ, cᵢ);
+      if (std::fmod(n, 2.0) != 0) {
+        sᵢ = -sᵢ;
+        cᵢ = -cᵢ;
+      }
     }
-  } else {
-    Angle const k = EllipticK(mc);
-    JacobiSNCNDNWithK(u, mc, k, s, c, d);
   }
 }
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include "quantities/quantities.hpp"
 
 // This code is derived from: [Fuk12a].  The original code has been translated
@@ -15,10 +17,37 @@ Angle JacobiAmplitude(Angle const& u, double mc);
 
 void JacobiSNCNDN(Angle const& u, double mc, double& s, double& c, double& d);
 
+// Batch versions of the above functions: the vectors |u| and |mc| must have the
+// same size, and the results for |u[i]| and |mc[i]| are written at index i of
+// the output vectors, which are resized as needed.  The results are identical
+// to those of the scalar functions, but K(m) is only computed once for each run
+// of equal values of |mc|.
+void JacobiAmplitude(std::vector<Angle> const& u,
+                     std::vector<double> const& mc,
+                     std::vector<Angle>& am);
+
+void JacobiSNCNDN(std::vector<Angle> const& u,
+                  std::vector<double> const& mc,
+                  std::vector<double>& s,
+                  std::vector<double>& c,
+                  std::vector<double>& d);
+
+// Computes sn, cn, dn and am at once, with a single argument reduction for each
+// element.  The amplitude is identical to that returned by |JacobiAmplitude|,
+// but sn, cn and dn may differ from those returned by |JacobiSNCNDN| by a few
+// ULPs for large arguments because the reduction is not the same.
+void JacobiSNCNDNAmplitude(std::vector<Angle> const& u,
+                           std::vector<double> const& mc,
+                           std::vector<double>& s,
+                           std::vector<double>& c,
+                           std::vector<double>& d,
+                           std::vector<Angle>& am);
+
 }  // namespace internal
 
 using internal::JacobiAmplitude;
 using internal::JacobiSNCNDN;
+using internal::JacobiSNCNDNAmplitude;
 
 }  // namespace _elliptic_functions
 }  // namespace numerics
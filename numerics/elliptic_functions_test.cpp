@@ -1,6 +1,7 @@
 #include "numerics/elliptic_functions.hpp"
 
 #include <limits>
+#include <vector>
 
 #include "glog/logging.h"
 #include "gmock/gmock.h"
@@ -16,6 +17,7 @@
 namespace principia {
 namespace numerics {
 
+using ::testing::Eq;
 using ::testing::Le;
 using ::testing::Lt;
 using namespace principia::numerics::_elliptic_functions;
@@ -105,6 +107,58 @@ TEST_F(EllipticFunctionsTest, Mathematica) {
   }
 }
 
+TEST_F(EllipticFunctionsTest, Batch) {
+  std::vector<Angle> u;
+  std::vector<double> mc;
+  for (double const mcᵢ : {0.01, 0.1, 0.5, 1.0}) {
+    Angle const k = EllipticK(mcᵢ);
+    for (int i = -40; i <= 40; ++i) {
+      u.push_back(i * k / 7.0);
+      mc.push_back(mcᵢ);
+    }
+  }
+
+  std::vector<double> s;
+  std::vector<double> c;
+  std::vector<double> d;
+  std::vector<Angle> am;
+  JacobiSNCNDN(u, mc, s, c, d);
+  JacobiAmplitude(u, mc, am);
+
+  std::vector<double> s_with_am;
+  std::vector<double> c_with_am;
+  std::vector<double> d_with_am;
+  std::vector<Angle> am_with_s;
+  JacobiSNCNDNAmplitude(u, mc, s_with_am, c_with_am, d_with_am, am_with_s);
+
+  ASSERT_EQ(u.size(), s.size());
+  ASSERT_EQ(u.size(), am.size());
+  ASSERT_EQ(u.size(), s_with_am.size());
+  ASSERT_EQ(u.size(), am_with_s.size());
+  for (int i = 0; i < u.size(); ++i) {
+    double expected_s;
+    double expected_c;
+    double expected_d;
+    JacobiSNCNDN(u[i], mc[i], expected_s, expected_c, expected_d);
+    Angle const expected_am = JacobiAmplitude(u[i], mc[i]);
+
+    // The batch functions are identical to the scalar ones.
+    EXPECT_THAT(s[i], Eq(expected_s)) << u[i] << " " << mc[i];
+    EXPECT_THAT(c[i], Eq(expected_c)) << u[i] << " " << mc[i];
+    EXPECT_THAT(d[i], Eq(expected_d)) << u[i] << " " << mc[i];
+    EXPECT_THAT(am[i], Eq(expected_am)) << u[i] << " " << mc[i];
+
+    // The combined function only differs by the argument reduction.
+    EXPECT_THAT(am_with_s[i], Eq(expected_am)) << u[i] << " " << mc[i];
+    EXPECT_THAT(AbsoluteError(expected_s, s_with_am[i]), Le(1e-14))
+        << u[i] << " " << mc[i];
+    EXPECT_THAT(AbsoluteError(expected_c, c_with_am[i]), Le(1e-14))
+        << u[i] << " " << mc[i];
+    EXPECT_THAT(AbsoluteError(expected_d, d_with_am[i]), Le(1e-14))
+        << u[i] << " " << mc[i];
+  }
+}
+
 #if !defined(_DEBUG)
 TEST_F(EllipticFunctionsTest, Monotonicity) {
   for (double const mc : {0.01, 0.1, 0.5}) {
@@ -6,6 +6,7 @@
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "base/tags.hpp"
 #include "glog/logging.h"
@@ -1981,6 +1982,23 @@ void FukushimaEllipticBDJ(Angle const& φ,
   return FukushimaEllipticBDJ<Angle>(φ, n, mc, B_φǀm, D_φǀm, J_φ_nǀm);
 }
 
+void FukushimaEllipticBDJ(std::vector<Angle> const& φ,
+                          std::vector<double> const& n,
+                          std::vector<double> const& mc,
+                          std::vector<Angle>& B_φǀm,
+                          std::vector<Angle>& D_φǀm,
+                          std::vector<Angle>& J_φ_nǀm) {
+  CHECK_EQ(φ.size(), n.size());
+  CHECK_EQ(φ.size(), mc.size());
+  B_φǀm.resize(φ.size());
+  D_φǀm.resize(φ.size());
+  J_φ_nǀm.resize(φ.size());
+  for (std::int64_t i = 0; i < φ.size(); ++i) {
+    FukushimaEllipticBDJ<Angle>(
+        φ[i], n[i], mc[i], B_φǀm[i], D_φǀm[i], J_φ_nǀm[i]);
+  }
+}
+
 void FukushimaEllipticBD(Angle const& φ,
                          double const mc,
                          Angle& B_φǀm,
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include "quantities/quantities.hpp"
 
 namespace principia {
@@ -25,6 +27,16 @@ void FukushimaEllipticBDJ(Angle const& φ,
                           Angle& D_φǀm,
                           Angle& J_φ_nǀm);
 
+// Batch version of the above function: the vectors |φ|, |n| and |mc| must have
+// the same size, and the results for |φ[i]|, |n[i]| and |mc[i]| are written at
+// index i of the output vectors, which are resized as needed.
+void FukushimaEllipticBDJ(std::vector<Angle> const& φ,
+                          std::vector<double> const& n,
+                          std::vector<double> const& mc,
+                          std::vector<Angle>& B_φǀm,
+                          std::vector<Angle>& D_φǀm,
+                          std::vector<Angle>& J_φ_nǀm);
+
 // Same as above, but does not compute J.
 void FukushimaEllipticBD(Angle const& φ, double mc, Angle& B_φǀm, Angle& D_φǀm);
 
@@ -3,6 +3,7 @@
 #include <optional>
 #include <type_traits>
 
+#include "base/thread_pool.hpp"
 #include "quantities/named_quantities.hpp"
 #include "quantities/quantities.hpp"
 
@@ -11,6 +12,7 @@ namespace numerics {
 namespace _quadrature {
 namespace internal {
 
+using namespace principia::base::_thread_pool;
 using namespace principia::quantities::_named_quantities;
 using namespace principia::quantities::_quantities;
 
@@ -34,6 +36,19 @@ AutomaticClenshawCurtis(
     std::optional<double> max_relative_error,
     std::optional<int> max_points);
 
+// Same as above, but the evaluations of |f| needed by each refinement are
+// distributed over the threads of |pool|.  |f| must be thread-safe.  The
+// result is identical to that of the sequential version.
+template<int initial_points = 3, typename Argument, typename Function>
+Primitive<std::invoke_result_t<Function, Argument>, Argument>
+AutomaticClenshawCurtis(
+    Function const& f,
+    Argument const& lower_bound,
+    Argument const& upper_bound,
+    std::optional<double> max_relative_error,
+    std::optional<int> max_points,
+    ThreadPool<void>& pool);
+
 // |points| must be of the form 2ᵖ + 1 for some p ∈ ℕ.  Returns the
 // Clenshaw-Curtis quadrature of f with the given number of points.
 template<int points, typename Argument, typename Function>
@@ -3,6 +3,7 @@
 #include "numerics/quadrature.hpp"
 
 #include <algorithm>
+#include <future>
 #include <memory>
 #include <vector>
 
@@ -44,11 +45,16 @@ Primitive<std::invoke_result_t<Function, Argument>, Argument> Gauss(
   return result * half_width;
 }
 
+// When a |pool| is given, a refinement that needs at least this many
+// evaluations is split into tasks of this many evaluations each.
+constexpr int evaluations_per_task = 16;
+
 template<int points, typename Argument, typename Function>
 void FillClenshawCurtisCache(
     Function const& f,
     Argument const& lower_bound,
     Argument const& upper_bound,
+    ThreadPool<void>* pool,
     std::vector<std::invoke_result_t<Function, Argument>>&
         f_cos_N⁻¹π_bit_reversed);
 
@@ -62,6 +68,7 @@ AutomaticClenshawCurtisImplementation(
     std::optional<int> const max_points,
     Primitive<std::invoke_result_t<Function, Argument>, Argument> const
         previous_estimate,
+    ThreadPool<void>* pool,
     std::vector<std::invoke_result_t<Function, Argument>>&
         f_cos_N⁻¹π_bit_reversed);
 
@@ -71,6 +78,7 @@ ClenshawCurtisImplementation(
     Function const& f,
     Argument const& lower_bound,
     Argument const& upper_bound,
+    ThreadPool<void>* pool,
     std::vector<std::invoke_result_t<Function, Argument>>&
         f_cos_N⁻¹π_bit_reversed);
 
@@ -96,11 +104,15 @@ ClenshawCurtisImplementation(
 // the regular cache starts at index 1.
 // Clients are expected to reserve (at least) points entries in the cache vector
 // for efficient heap allocation.
+// The evaluations for s odd are independent from each other, so when a |pool|
+// is given they are done in parallel, directly into their final position in the
+// cache.
 template<int points, typename Argument, typename Function>
 void FillClenshawCurtisCache(
     Function const& f,
     Argument const& lower_bound,
     Argument const& upper_bound,
+    ThreadPool<void>* pool,
     std::vector<std::invoke_result_t<Function, Argument>>&
         f_cos_N⁻¹π_bit_reversed) {
   // If we identify [lower_bound, upper_bound] with [-1, 1],
@@ -131,16 +143,45 @@ void FillClenshawCurtisCache(
     // of N.
     FillClenshawCurtisCache<N / 2 + 1>(f,
                                        lower_bound, upper_bound,
+                                       pool,
                                        f_cos_N⁻¹π_bit_reversed);
     // N/2 evaluations for f(cos πs/N) with s odd.  Note the need to preserve
     // bit-reversed ordering.
-    int reverse = 0;
-    for (int evaluations = 0;
-         evaluations < N / 2;
-         ++evaluations, reverse = BitReversedIncrement(reverse, log2_N - 1)) {
-      int const s = 2 * reverse + 1;
-      f_cos_N⁻¹π_bit_reversed.push_back(
-          f(lower_bound + half_width * (1 + ЧебышёвLobattoPoint<N>(s))));
+    if (pool == nullptr || N / 2 < evaluations_per_task) {
+      int reverse = 0;
+      for (int evaluations = 0;
+           evaluations < N / 2;
+           ++evaluations, reverse = BitReversedIncrement(reverse, log2_N - 1)) {
+        int const s = 2 * reverse + 1;
+        f_cos_N⁻¹π_bit_reversed.push_back(
+            f(lower_bound + half_width * (1 + ЧебышёвLobattoPoint<N>(s))));
+      }
+    } else {
+      std::vector<Argument> arguments;
+      arguments.reserve(N / 2);
+      int reverse = 0;
+      for (int evaluations = 0;
+           evaluations < N / 2;
+           ++evaluations, reverse = BitReversedIncrement(reverse, log2_N - 1)) {
+        int const s = 2 * reverse + 1;
+        arguments.push_back(
+            lower_bound + half_width * (1 + ЧебышёвLobattoPoint<N>(s)));
+      }
+      std::int64_t const first = f_cos_N⁻¹π_bit_reversed.size();
+      f_cos_N⁻¹π_bit_reversed.resize(first + N / 2);
+      std::vector<std::future<void>> futures;
+      for (int begin = 0; begin < N / 2; begin += evaluations_per_task) {
+        futures.push_back(pool->Add(
+            [begin, first, &arguments, &f, &f_cos_N⁻¹π_bit_reversed]() {
+              int const end = std::min(begin + evaluations_per_task, N / 2);
+              for (int i = begin; i < end; ++i) {
+                f_cos_N⁻¹π_bit_reversed[first + i] = f(arguments[i]);
+              }
+            }));
+      }
+      for (auto& future : futures) {
+        future.get();
+      }
     }
   }
 }
@@ -155,13 +196,14 @@ AutomaticClenshawCurtisImplementation(
     std::optional<int> const max_points,
     Primitive<std::invoke_result_t<Function, Argument>, Argument> const
         previous_estimate,
+    ThreadPool<void>* pool,
     std::vector<std::invoke_result_t<Function, Argument>>&
         f_cos_N⁻¹π_bit_reversed) {
   using Result = Primitive<std::invoke_result_t<Function, Argument>, Argument>;
 
   Result const estimate =
       ClenshawCurtisImplementation<points>(
-          f, lower_bound, upper_bound, f_cos_N⁻¹π_bit_reversed);
+          f, lower_bound, upper_bound, pool, f_cos_N⁻¹π_bit_reversed);
 
   // This is the naïve estimate mentioned in [Gen72b], p. 339.
   auto const absolute_error_estimate =
@@ -183,6 +225,7 @@ AutomaticClenshawCurtisImplementation(
           lower_bound, upper_bound,
           max_relative_error, max_points,
           estimate,
+          pool,
           f_cos_N⁻¹π_bit_reversed);
     }
   }
@@ -195,6 +238,7 @@ ClenshawCurtisImplementation(
     Function const& f,
     Argument const& lower_bound,
     Argument const& upper_bound,
+    ThreadPool<void>* pool,
     std::vector<std::invoke_result_t<Function, Argument>>&
         f_cos_N⁻¹π_bit_reversed) {
   // We follow the notation from [Gen72b] and [Gen72c].
@@ -207,7 +251,7 @@ ClenshawCurtisImplementation(
   constexpr Angle N⁻¹π = π * Radian / N;
 
   FillClenshawCurtisCache<points>(
-      f, lower_bound, upper_bound, f_cos_N⁻¹π_bit_reversed);
+      f, lower_bound, upper_bound, pool, f_cos_N⁻¹π_bit_reversed);
 
   // TODO(phl): If might be possible to avoid copies since
   // f_cos_N⁻¹π_bit_reversed is tantalizing close to the order needed for the
@@ -274,12 +318,37 @@ AutomaticClenshawCurtis(
   std::vector<Value> f_cos_N⁻¹π_bit_reversed;
   f_cos_N⁻¹π_bit_reversed.reserve(2 * initial_points - 1);
   Result const estimate = ClenshawCurtisImplementation<initial_points>(
-      f, lower_bound, upper_bound, f_cos_N⁻¹π_bit_reversed);
+      f, lower_bound, upper_bound, /*pool=*/nullptr, f_cos_N⁻¹π_bit_reversed);
+  return AutomaticClenshawCurtisImplementation<2 * initial_points - 1>(
+      f,
+      lower_bound, upper_bound,
+      max_relative_error, max_points,
+      estimate,
+      /*pool=*/nullptr,
+      f_cos_N⁻¹π_bit_reversed);
+}
+
+template<int initial_points, typename Argument, typename Function>
+Primitive<std::invoke_result_t<Function, Argument>, Argument>
+AutomaticClenshawCurtis(
+    Function const& f,
+    Argument const& lower_bound,
+    Argument const& upper_bound,
+    std::optional<double> const max_relative_error,
+    std::optional<int> const max_points,
+    ThreadPool<void>& pool) {
+  using Result = Primitive<std::invoke_result_t<Function, Argument>, Argument>;
+  using Value = std::invoke_result_t<Function, Argument>;
+  std::vector<Value> f_cos_N⁻¹π_bit_reversed;
+  f_cos_N⁻¹π_bit_reversed.reserve(2 * initial_points - 1);
+  Result const estimate = ClenshawCurtisImplementation<initial_points>(
+      f, lower_bound, upper_bound, &pool, f_cos_N⁻¹π_bit_reversed);
   return AutomaticClenshawCurtisImplementation<2 * initial_points - 1>(
       f,
       lower_bound, upper_bound,
       max_relative_error, max_points,
       estimate,
+      &pool,
       f_cos_N⁻¹π_bit_reversed);
 }
 
@@ -292,7 +361,7 @@ Primitive<std::invoke_result_t<Function, Argument>, Argument> ClenshawCurtis(
   std::vector<Value> f_cos_N⁻¹π_bit_reversed;
   f_cos_N⁻¹π_bit_reversed.reserve(points);
   return ClenshawCurtisImplementation<points>(
-      f, lower_bound, upper_bound, f_cos_N⁻¹π_bit_reversed);
+      f, lower_bound, upper_bound, /*pool=*/nullptr, f_cos_N⁻¹π_bit_reversed);
 }
 
 inline std::optional<int> MaxPointsHeuristicsForAutomaticClenshawCurtis(
@@ -1,7 +1,9 @@
 #include "numerics/quadrature.hpp"
 
+#include <atomic>
 #include <limits>
 
+#include "base/thread_pool.hpp"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "quantities/elementary_functions.hpp"
@@ -18,6 +20,7 @@ namespace quadrature {
 
 using ::testing::AnyOf;
 using ::testing::Eq;
+using namespace principia::base::_thread_pool;
 using namespace principia::numerics::_quadrature;
 using namespace principia::quantities::_elementary_functions;
 using namespace principia::quantities::_quantities;
@@ -133,6 +136,34 @@ TEST_F(QuadratureTest, Sin10) {
               AnyOf(Eq(32769), Eq(65537), Eq(262145), Eq(524289), Eq(1048577)));
 }
 
+TEST_F(QuadratureTest, Sin10Parallel) {
+  ThreadPool<void> pool(/*pool_size=*/4);
+  std::atomic_int evaluations = 0;
+  auto const f = [&evaluations](Angle const x) {
+    ++evaluations;
+    return Sin(10 * x);
+  };
+  auto const sequential = AutomaticClenshawCurtis(
+      f,
+      -2.0 * Radian,
+      5.0 * Radian,
+      /*max_relative_error=*/std::numeric_limits<double>::epsilon(),
+      /*max_points=*/std::nullopt);
+  int const sequential_evaluations = evaluations;
+  evaluations = 0;
+  // The parallel quadrature evaluates the function at the same points, and
+  // only once at each point.
+  EXPECT_THAT(AutomaticClenshawCurtis(
+                  f,
+                  -2.0 * Radian,
+                  5.0 * Radian,
+                  /*max_relative_error=*/std::numeric_limits<double>::epsilon(),
+                  /*max_points=*/std::nullopt,
+                  pool),
+              Eq(sequential));
+  EXPECT_EQ(sequential_evaluations, evaluations);
+}
+
 }  // namespace quadrature
 }  // namespace numerics
 }  // namespace principia
@@ -3,11 +3,19 @@
 #include "physics/apsides.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <iterator>
 #include <list>
 #include <optional>
+#include <thread>
 #include <vector>
 
 #include "base/array.hpp"
+#include "base/jthread.hpp"
+#include "base/thread_pool.hpp"
 #include "geometry/barycentre_calculator.hpp"
 #include "geometry/r3_element.hpp"
 #include "geometry/sign.hpp"
@@ -26,6 +34,8 @@ namespace _apsides {
 namespace internal {
 
 using namespace principia::base::_array;
+using namespace principia::base::_jthread;
+using namespace principia::base::_thread_pool;
 using namespace principia::geometry::_barycentre_calculator;
 using namespace principia::geometry::_r3_element;
 using namespace principia::geometry::_sign;
@@ -51,16 +61,154 @@ constexpr int max_чебышёв_degree = 8;
 // The error bound |max_collision_error| is guaranteed to be met if the vessel
 // is slower than this.
 constexpr Speed max_collision_speed = 10'000 * Metre / Second;
+// The number of points of the trajectory scanned by each parallel task of
+// |ComputeApsides| and |ComputeNodes|.  Shorter trajectories are scanned on the
+// calling thread.  One point costs about one evaluation of the reference
+// trajectory, so this is large enough to amortize the cost of a task.
+constexpr std::int64_t points_per_chunk = 1024;
+
+// The pool used to scan the chunks.  Never destroyed, as it may be used during
+// static destruction.
+inline ThreadPool<void>& ChunkPool() {
+  static auto* const pool = new ThreadPool<void>(
+      std::max(1u, std::thread::hardware_concurrency()));
+  return *pool;
+}
 
-template<typename Frame>
-void ComputeApsides(Trajectory<Frame> const& reference,
-                    Trajectory<Frame> const& trajectory,
-                    typename DiscreteTrajectory<Frame>::iterator const begin,
-                    typename DiscreteTrajectory<Frame>::iterator const end,
-                    Instant const& t_max,
-                    int const max_points,
-                    DiscreteTrajectory<Frame>& apoapsides,
-                    DiscreteTrajectory<Frame>& periapsides) {
+// Splits the range [begin, end[ of a trajectory into chunks of
+// |points_per_chunk| points, and calls
+// |compute_in_chunk(chunk_begin, chunk_end, output1, output2, must_stop)| on
+// each of them in parallel.  Consecutive chunks share one point so that the
+// extrema between the last point of a chunk and the first point of the next
+// chunk are found.  |compute_in_chunk| must append its results to |output1| and
+// |output2| in time order, poll the nullary predicate |must_stop| for
+// cancellation, and return false if it stopped before the end of the chunk.
+// The results of the chunks are appended in order to |output1| and |output2|,
+// until both have at least |max_points| points or a chunk stops early; the
+// result is the same as that of a single call to |compute_in_chunk| on
+// [begin, end[.  The chunks are created lazily and only a few of them are in
+// flight at any time, so that the range is not traversed past |t_max| or past
+// the point where |max_points| points have been found.
+template<typename Frame, typename ComputeInChunk>
+void ComputeInParallelChunks(
+    typename DiscreteTrajectory<Frame>::iterator const begin,
+    typename DiscreteTrajectory<Frame>::iterator const end,
+    Instant const& t_max,
+    int const max_points,
+    DiscreteTrajectory<Frame>& output1,
+    DiscreteTrajectory<Frame>& output2,
+    ComputeInChunk const& compute_in_chunk) {
+  using Iterator = typename DiscreteTrajectory<Frame>::iterator;
+  std::atomic_bool cancelled = false;
+  auto const must_stop = [&cancelled]() { return cancelled.load(); };
+
+  // Returns the end of the chunk that starts at |chunk_begin|, and sets
+  // |next_chunk_begin| to the beginning of the next chunk, or to |end| if this
+  // is the last chunk.  The points after |t_max| are never scanned, so they
+  // end the last chunk.
+  auto const find_chunk_end = [end, &t_max](Iterator const chunk_begin,
+                                            Iterator& next_chunk_begin) {
+    auto it = chunk_begin;
+    for (std::int64_t i = 0; i < points_per_chunk; ++i) {
+      if (it == end || it->time > t_max) {
+        next_chunk_begin = end;
+        return it;
+      }
+      ++it;
+    }
+    if (it == end || it->time > t_max) {
+      next_chunk_begin = end;
+      return it;
+    }
+    next_chunk_begin = it;
+    return std::next(it);
+  };
+
+  Iterator next_chunk_begin = begin;
+  Iterator const first_chunk_end = find_chunk_end(begin, next_chunk_begin);
+  if (next_chunk_begin == end) {
+    compute_in_chunk(begin, first_chunk_end, output1, output2, must_stop);
+    return;
+  }
+
+  struct ChunkResult {
+    DiscreteTrajectory<Frame> output1;
+    DiscreteTrajectory<Frame> output2;
+    bool completed = false;
+  };
+  // Pushing to or popping from a deque doesn't invalidate references to the
+  // other elements, so the tasks may reference their result.
+  std::deque<ChunkResult> results;
+  std::deque<std::future<void>> futures;
+  auto const add_chunk = [&compute_in_chunk, &futures, &must_stop, &results](
+                             Iterator const chunk_begin,
+                             Iterator const chunk_end) {
+    futures.push_back(ChunkPool().Add(
+        [chunk_begin, chunk_end, &compute_in_chunk, &must_stop,
+         &result = results.emplace_back()]() {
+          result.completed = compute_in_chunk(chunk_begin,
+                                              chunk_end,
+                                              result.output1,
+                                              result.output2,
+                                              must_stop);
+        }));
+  };
+  unsigned const max_chunks_in_flight =
+      2 * std::max(1u, std::thread::hardware_concurrency());
+
+  // Merge the results in order, adding chunks as the merge progresses.  Within
+  // a chunk, the points of the two outputs are interleaved in time order, as
+  // they would be found by a sequential scan, so that |max_points| is honoured
+  // in the same way.
+  add_chunk(begin, first_chunk_end);
+  bool done = false;
+  while (!done && !futures.empty()) {
+    while (next_chunk_begin != end && futures.size() < max_chunks_in_flight) {
+      Iterator const chunk_begin = next_chunk_begin;
+      Iterator const chunk_end = find_chunk_end(chunk_begin, next_chunk_begin);
+      add_chunk(chunk_begin, chunk_end);
+    }
+    futures.front().wait();
+    auto const& result = results.front();
+    auto it1 = result.output1.begin();
+    auto it2 = result.output2.begin();
+    while (!done && (it1 != result.output1.end() ||
+                     it2 != result.output2.end())) {
+      if (it2 == result.output2.end() ||
+          (it1 != result.output1.end() && it1->time < it2->time)) {
+        output1.Append(it1->time, it1->degrees_of_freedom).IgnoreError();
+        ++it1;
+      } else {
+        output2.Append(it2->time, it2->degrees_of_freedom).IgnoreError();
+        ++it2;
+      }
+      done = output1.size() >= max_points && output2.size() >= max_points;
+    }
+    done |= !result.completed;
+    futures.pop_front();
+    results.pop_front();
+  }
+
+  // The tasks reference local variables, so we must wait for all of them.
+  cancelled = true;
+  for (auto const& future : futures) {
+    future.wait();
+  }
+}
+
+// Computes the apsides over [begin, end[; the extrema are found between
+// consecutive points.  Returns false if it stopped early.
+template<typename Frame, typename MustStop>
+bool ComputeApsidesInChunk(
+    Trajectory<Frame> const& reference,
+    Trajectory<Frame> const& trajectory,
+    typename DiscreteTrajectory<Frame>::iterator const begin,
+    typename DiscreteTrajectory<Frame>::iterator const end,
+    Instant const& t_max,
+    int const max_points,
+    DiscreteTrajectory<Frame>& apoapsides,
+    DiscreteTrajectory<Frame>& periapsides,
+    MustStop const& must_stop) {
   std::optional<Instant> previous_time;
   std::optional<DegreesOfFreedom<Frame>> previous_degrees_of_freedom;
   std::optional<Square<Length>> previous_squared_distance;
@@ -70,12 +218,15 @@ void ComputeApsides(Trajectory<Frame> const& reference,
   Instant const effective_t_min = reference.t_min();
   Instant const effective_t_max = std::min(t_max, reference.t_max());
   for (auto it = begin; it != end; ++it) {
+    if (must_stop()) {
+      return false;
+    }
     auto const& [time, degrees_of_freedom] = *it;
     if (time < effective_t_min) {
       continue;
     }
     if (time > effective_t_max) {
-      break;
+      return false;
     }
     DegreesOfFreedom<Frame> const body_degrees_of_freedom =
         reference.EvaluateDegreesOfFreedom(time);
@@ -132,7 +283,7 @@ void ComputeApsides(Trajectory<Frame> const& reference,
       // This can happen for instance if the square distance is stationary.
       // Safer to give up.
       if (!IsFinite(apsis_time - Instant{})) {
-        break;
+        return false;
       }
 
       // Now that we know the time of the apsis, use a Hermite approximation to
@@ -150,7 +301,7 @@ void ComputeApsides(Trajectory<Frame> const& reference,
         periapsides.Append(apsis_time, apsis_degrees_of_freedom).IgnoreError();
       }
       if (apoapsides.size() >= max_points && periapsides.size() >= max_points) {
-        break;
+        return false;
       }
     }
 
@@ -159,6 +310,122 @@ void ComputeApsides(Trajectory<Frame> const& reference,
     previous_squared_distance = squared_distance;
     previous_squared_distance_derivative = squared_distance_derivative;
   }
+  return true;
+}
+
+// Computes the nodes over [begin, end[; the crossings are found between
+// consecutive points.  Returns false if it stopped early.
+template<typename Frame, typename Predicate, typename MustStop>
+bool ComputeNodesInChunk(
+    Trajectory<Frame> const& trajectory,
+    typename DiscreteTrajectory<Frame>::iterator const begin,
+    typename DiscreteTrajectory<Frame>::iterator const end,
+    Instant const& t_max,
+    Vector<double, Frame> const& north,
+    int const max_points,
+    DiscreteTrajectory<Frame>& ascending,
+    DiscreteTrajectory<Frame>& descending,
+    Predicate const& predicate,
+    MustStop const& must_stop) {
+  std::optional<Instant> previous_time;
+  std::optional<Length> previous_z;
+  std::optional<Speed> previous_z_speed;
+
+  for (auto it = begin; it != end; ++it) {
+    if (must_stop()) {
+      return false;
+    }
+    auto const& [time, degrees_of_freedom] = *it;
+    if (time > t_max) {
+      return false;
+    }
+    Length const z =
+        (degrees_of_freedom.position() - Frame::origin).coordinates().z;
+    Speed const z_speed = degrees_of_freedom.velocity().coordinates().z;
+
+    if (previous_z && Sign(z) != Sign(*previous_z)) {
+      CHECK(previous_time && previous_z_speed);
+
+      // |z| changed sign.  Construct a Hermite approximation of |z| and find
+      // its zeros.
+      Hermite3<Length, Instant> const z_approximation(
+          {*previous_time, time},
+          {*previous_z, z},
+          {*previous_z_speed, z_speed});
+
+      Instant node_time;
+      if (Sign(z_approximation.Evaluate(*previous_time)) ==
+          Sign(z_approximation.Evaluate(time))) {
+        // The Hermite approximation is poorly conditioned, let's use a linear
+        // approximation
+        node_time = Barycentre({*previous_time, time}, {z, -*previous_z});
+      } else {
+        // The normal case, find the intersection with z = 0 using Brent's
+        // method.
+        node_time = Brent(
+            [&z_approximation](Instant const& t) {
+              return z_approximation.Evaluate(t);
+            },
+            *previous_time,
+            time);
+      }
+
+      DegreesOfFreedom<Frame> const node_degrees_of_freedom =
+          trajectory.EvaluateDegreesOfFreedom(node_time);
+      if (predicate(node_degrees_of_freedom)) {
+        if (Sign(InnerProduct(north, Vector<double, Frame>({0, 0, 1}))) ==
+            Sign(z_speed)) {
+          // |north| is up and we are going up, or |north| is down and we are
+          // going down.
+          ascending.Append(node_time, node_degrees_of_freedom).IgnoreError();
+        } else {
+          descending.Append(node_time, node_degrees_of_freedom).IgnoreError();
+        }
+        if (ascending.size() >= max_points && descending.size() >= max_points) {
+          return false;
+        }
+      }
+    }
+
+    previous_time = time;
+    previous_z = z;
+    previous_z_speed = z_speed;
+  }
+  return true;
+}
+
+template<typename Frame>
+void ComputeApsides(Trajectory<Frame> const& reference,
+                    Trajectory<Frame> const& trajectory,
+                    typename DiscreteTrajectory<Frame>::iterator const begin,
+                    typename DiscreteTrajectory<Frame>::iterator const end,
+                    Instant const& t_max,
+                    int const max_points,
+                    DiscreteTrajectory<Frame>& apoapsides,
+                    DiscreteTrajectory<Frame>& periapsides) {
+  ComputeInParallelChunks<Frame>(
+      begin,
+      end,
+      t_max,
+      max_points,
+      apoapsides,
+      periapsides,
+      [&reference, &trajectory, &t_max, max_points](
+          typename DiscreteTrajectory<Frame>::iterator const chunk_begin,
+          typename DiscreteTrajectory<Frame>::iterator const chunk_end,
+          DiscreteTrajectory<Frame>& chunk_apoapsides,
+          DiscreteTrajectory<Frame>& chunk_periapsides,
+          auto const& must_stop) {
+        return ComputeApsidesInChunk(reference,
+                                     trajectory,
+                                     chunk_begin,
+                                     chunk_end,
+                                     t_max,
+                                     max_points,
+                                     chunk_apoapsides,
+                                     chunk_periapsides,
+                                     must_stop);
+      });
 }
 
 template<typename Frame>
@@ -492,68 +759,38 @@ absl::Status ComputeNodes(
                           bool>::value,
       "|predicate| must be a predicate on |DegreesOfFreedom<Frame>|");
 
-  std::optional<Instant> previous_time;
-  std::optional<Length> previous_z;
-  std::optional<Speed> previous_z_speed;
-
-  for (auto it = begin; it != end; ++it) {
-    RETURN_IF_STOPPED;
-    auto const& [time, degrees_of_freedom] = *it;
-    if (time > t_max) {
-      break;
-    }
-    Length const z =
-        (degrees_of_freedom.position() - Frame::origin).coordinates().z;
-    Speed const z_speed = degrees_of_freedom.velocity().coordinates().z;
-
-    if (previous_z && Sign(z) != Sign(*previous_z)) {
-      CHECK(previous_time && previous_z_speed);
-
-      // |z| changed sign.  Construct a Hermite approximation of |z| and find
-      // its zeros.
-      Hermite3<Length, Instant> const z_approximation(
-          {*previous_time, time},
-          {*previous_z, z},
-          {*previous_z_speed, z_speed});
-
-      Instant node_time;
-      if (Sign(z_approximation.Evaluate(*previous_time)) ==
-          Sign(z_approximation.Evaluate(time))) {
-        // The Hermite approximation is poorly conditioned, let's use a linear
-        // approximation
-        node_time = Barycentre({*previous_time, time}, {z, -*previous_z});
-      } else {
-        // The normal case, find the intersection with z = 0 using Brent's
-        // method.
-        node_time = Brent(
-            [&z_approximation](Instant const& t) {
-              return z_approximation.Evaluate(t);
-            },
-            *previous_time,
-            time);
-      }
-
-      DegreesOfFreedom<Frame> const node_degrees_of_freedom =
-          trajectory.EvaluateDegreesOfFreedom(node_time);
-      if (predicate(node_degrees_of_freedom)) {
-        if (Sign(InnerProduct(north, Vector<double, Frame>({0, 0, 1}))) ==
-            Sign(z_speed)) {
-          // |north| is up and we are going up, or |north| is down and we are
-          // going down.
-          ascending.Append(node_time, node_degrees_of_freedom).IgnoreError();
-        } else {
-          descending.Append(node_time, node_degrees_of_freedom).IgnoreError();
-        }
-        if (ascending.size() >= max_points && descending.size() >= max_points) {
-          break;
-        }
-      }
-    }
-
-    previous_time = time;
-    previous_z = z;
-    previous_z_speed = z_speed;
-  }
+  // The chunks may be scanned by other threads, which must honour the stop
+  // token of this thread.
+  stop_token const caller_stop_token =
+      this_stoppable_thread::get_stop_token();
+  ComputeInParallelChunks<Frame>(
+      begin,
+      end,
+      t_max,
+      max_points,
+      ascending,
+      descending,
+      [&trajectory, &t_max, &north, max_points, &predicate, &caller_stop_token](
+          typename DiscreteTrajectory<Frame>::iterator const chunk_begin,
+          typename DiscreteTrajectory<Frame>::iterator const chunk_end,
+          DiscreteTrajectory<Frame>& chunk_ascending,
+          DiscreteTrajectory<Frame>& chunk_descending,
+          auto const& must_stop) {
+        return ComputeNodesInChunk(
+            trajectory,
+            chunk_begin,
+            chunk_end,
+            t_max,
+            north,
+            max_points,
+            chunk_ascending,
+            chunk_descending,
+            predicate,
+            /*must_stop=*/[&must_stop, &caller_stop_token]() {
+              return must_stop() || caller_stop_token.stop_requested();
+            });
+      });
+  RETURN_IF_STOPPED;
   return absl::OkStatus();
 }
 
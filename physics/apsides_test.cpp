@@ -476,6 +476,132 @@ TEST_F(ApsidesTest, ComputeNodes) {
 
 #endif
 
+// A trajectory long enough to be split in several chunks scanned in parallel.
+// The extrema and nodes must be found exactly once, including near the
+// boundaries of the chunks, and in time order.
+TEST_F(ApsidesTest, LongTrajectory) {
+  Instant const t0;
+  Time const Δt = 1.0 / 128.0 * Second;
+  Instant const t1 = t0 + Δt / 3;
+  AngularFrequency const ω = 2 * π * Radian / Second;
+
+  // A slightly tilted circle with a period of 1 s, seen from a reference that
+  // is not at its centre.  The periapsides and the ascending nodes are at
+  // integral times, the apoapsides and the descending nodes at half-integral
+  // times.
+  DiscreteTrajectory<World> reference_trajectory;
+  DiscreteTrajectory<World> vessel_trajectory;
+  Position<World> const reference_position =
+      World::origin + Displacement<World>({0.5 * Metre, 0 * Metre, 0 * Metre});
+  for (int i = 0; i < 40 * 128; ++i) {
+    Instant const t = t1 + i * Δt;
+    Angle const θ = ω * (t - t0);
+    EXPECT_OK(reference_trajectory.Append(
+        t, DegreesOfFreedom<World>(reference_position, World::unmoving)));
+    EXPECT_OK(vessel_trajectory.Append(
+        t,
+        DegreesOfFreedom<World>(
+            World::origin + Displacement<World>({Cos(θ) * Metre,
+                                                 Sin(θ) * Metre,
+                                                 0.1 * Sin(θ) * Metre}),
+            Velocity<World>({-Sin(θ) * ω * Metre / Radian,
+                             Cos(θ) * ω * Metre / Radian,
+                             0.1 * Cos(θ) * ω * Metre / Radian}))));
+  }
+
+  auto const expect_times = [t0](DiscreteTrajectory<World> const& points,
+                                 double const first_time) {
+    double expected_time = first_time;
+    for (auto const& [time, degrees_of_freedom] : points) {
+      EXPECT_LT(Abs(time - (t0 + expected_time * Second)), 1e-5 * Second);
+      expected_time += 1;
+    }
+  };
+
+  {
+    DiscreteTrajectory<World> apoapsides;
+    DiscreteTrajectory<World> periapsides;
+    ComputeApsides(reference_trajectory,
+                   vessel_trajectory,
+                   vessel_trajectory.begin(),
+                   vessel_trajectory.end(),
+                   /*t_max=*/InfiniteFuture,
+                   /*max_points=*/std::numeric_limits<int>::max(),
+                   apoapsides,
+                   periapsides);
+    EXPECT_THAT(apoapsides, SizeIs(40));
+    EXPECT_THAT(periapsides, SizeIs(39));
+    expect_times(apoapsides, 0.5);
+    expect_times(periapsides, 1);
+  }
+  {
+    // The scan stops at the same point as a sequential scan would.
+    DiscreteTrajectory<World> apoapsides;
+    DiscreteTrajectory<World> periapsides;
+    ComputeApsides(reference_trajectory,
+                   vessel_trajectory,
+                   vessel_trajectory.begin(),
+                   vessel_trajectory.end(),
+                   /*t_max=*/InfiniteFuture,
+                   /*max_points=*/20,
+                   apoapsides,
+                   periapsides);
+    EXPECT_THAT(apoapsides, SizeIs(20));
+    EXPECT_THAT(periapsides, SizeIs(20));
+    expect_times(apoapsides, 0.5);
+    expect_times(periapsides, 1);
+  }
+  {
+    DiscreteTrajectory<World> apoapsides;
+    DiscreteTrajectory<World> periapsides;
+    ComputeApsides(reference_trajectory,
+                   vessel_trajectory,
+                   vessel_trajectory.begin(),
+                   vessel_trajectory.end(),
+                   /*t_max=*/InfiniteFuture,
+                   /*max_points=*/1,
+                   apoapsides,
+                   periapsides);
+    EXPECT_THAT(apoapsides, SizeIs(1));
+    EXPECT_THAT(periapsides, SizeIs(1));
+    expect_times(apoapsides, 0.5);
+    expect_times(periapsides, 1);
+  }
+  {
+    // The chunks past |t_max| are not scanned.
+    DiscreteTrajectory<World> apoapsides;
+    DiscreteTrajectory<World> periapsides;
+    ComputeApsides(reference_trajectory,
+                   vessel_trajectory,
+                   vessel_trajectory.begin(),
+                   vessel_trajectory.end(),
+                   /*t_max=*/t0 + 20.25 * Second,
+                   /*max_points=*/std::numeric_limits<int>::max(),
+                   apoapsides,
+                   periapsides);
+    EXPECT_THAT(apoapsides, SizeIs(20));
+    EXPECT_THAT(periapsides, SizeIs(20));
+    expect_times(apoapsides, 0.5);
+    expect_times(periapsides, 1);
+  }
+  {
+    DiscreteTrajectory<World> ascending_nodes;
+    DiscreteTrajectory<World> descending_nodes;
+    EXPECT_OK(ComputeNodes(vessel_trajectory,
+                           vessel_trajectory.begin(),
+                           vessel_trajectory.end(),
+                           /*t_max=*/InfiniteFuture,
+                           Vector<double, World>({0, 0, 1}),
+                           /*max_points=*/std::numeric_limits<int>::max(),
+                           ascending_nodes,
+                           descending_nodes));
+    EXPECT_THAT(ascending_nodes, SizeIs(39));
+    EXPECT_THAT(descending_nodes, SizeIs(40));
+    expect_times(ascending_nodes, 1);
+    expect_times(descending_nodes, 0.5);
+  }
+}
+
 // A dedicated fixture for |ComputeCollisionIntervals| because we have many
 // tests for that function.
 class ApsidesTest_ComputeCollisionIntervals : public ::testing::Test {
@@ -140,13 +140,15 @@ template<typename InertialFrame, typename ThisFrame>
 RigidMotion<InertialFrame, ThisFrame>
 BarycentricRotatingReferenceFrame<InertialFrame, ThisFrame>::ToThisFrameAtTime(
     Instant const& t) const {
-  auto const r₁ = PrimaryDerivative<0>(t);
-  auto const ṙ₁ = PrimaryDerivative<1>(t);
-  auto const r̈₁ = PrimaryDerivative<2>(t);
-  auto const r₂ = SecondaryDerivative<0>(t);
-  auto const ṙ₂ = SecondaryDerivative<1>(t);
-  auto const r̈₂ = SecondaryDerivative<2>(t);
-  return ToThisFrame({r₁, ṙ₁, r̈₁}, {r₂, ṙ₂, r̈₂});
+  return this->MemoizedToThisFrameAtTime(t, [this, &t]() {
+    auto const r₁ = PrimaryDerivative<0>(t);
+    auto const ṙ₁ = PrimaryDerivative<1>(t);
+    auto const r̈₁ = PrimaryDerivative<2>(t);
+    auto const r₂ = SecondaryDerivative<0>(t);
+    auto const ṙ₂ = SecondaryDerivative<1>(t);
+    auto const r̈₂ = SecondaryDerivative<2>(t);
+    return ToThisFrame({r₁, ṙ₁, r̈₁}, {r₂, ṙ₂, r̈₂});
+  });
 }
 
 template<typename InertialFrame, typename ThisFrame>
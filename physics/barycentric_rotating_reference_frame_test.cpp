@@ -1,8 +1,11 @@
 #include "physics/barycentric_rotating_reference_frame.hpp"
 
 #include <memory>
+#include <thread>
+#include <vector>
 
 #include "astronomy/frames.hpp"
+#include "base/not_null.hpp"
 #include "geometry/barycentre_calculator.hpp"
 #include "geometry/frame.hpp"
 #include "geometry/grassmann.hpp"
@@ -15,6 +18,7 @@
 #include "physics/degrees_of_freedom.hpp"
 #include "physics/ephemeris.hpp"
 #include "physics/massive_body.hpp"
+#include "physics/rigid_motion.hpp"
 #include "physics/rigid_reference_frame.hpp"
 #include "physics/solar_system.hpp"
 #include "quantities/elementary_functions.hpp"
@@ -36,6 +40,7 @@ using ::testing::Not;
 using ::testing::Return;
 using ::testing::_;
 using namespace principia::astronomy::_frames;
+using namespace principia::base::_not_null;
 using namespace principia::geometry::_barycentre_calculator;
 using namespace principia::geometry::_frame;
 using namespace principia::geometry::_grassmann;
@@ -47,6 +52,7 @@ using namespace principia::physics::_barycentric_rotating_reference_frame;
 using namespace principia::physics::_degrees_of_freedom;
 using namespace principia::physics::_ephemeris;
 using namespace principia::physics::_massive_body;
+using namespace principia::physics::_rigid_motion;
 using namespace principia::physics::_rigid_reference_frame;
 using namespace principia::physics::_solar_system;
 using namespace principia::quantities::_elementary_functions;
@@ -71,6 +77,38 @@ class BarycentricRotatingReferenceFrameTest : public ::testing::Test {
                               Handedness::Right,
                               serialization::Frame::TEST>;
 
+  // A frame that memoizes the motions obtained from |reference_frame| and
+  // counts how many of them are actually computed.
+  class CountingReferenceFrame
+      : public BarycentricRotatingReferenceFrame<ICRS, BigSmallFrame> {
+   public:
+    CountingReferenceFrame(
+        not_null<Ephemeris<ICRS> const*> const ephemeris,
+        not_null<MassiveBody const*> const primary,
+        not_null<MassiveBody const*> const secondary,
+        not_null<RigidReferenceFrame<ICRS, BigSmallFrame> const*> const
+            reference_frame)
+        : BarycentricRotatingReferenceFrame(ephemeris, primary, secondary),
+          reference_frame_(reference_frame) {}
+
+    RigidMotion<ICRS, BigSmallFrame> CountingToThisFrameAtTime(
+        Instant const& t) const {
+      return MemoizedToThisFrameAtTime(t, [this, &t]() {
+        ++computations_;
+        return reference_frame_->ToThisFrameAtTime(t);
+      });
+    }
+
+    int computations() const {
+      return computations_;
+    }
+
+   private:
+    not_null<RigidReferenceFrame<ICRS, BigSmallFrame> const*> const
+        reference_frame_;
+    mutable int computations_ = 0;
+  };
+
   BarycentricRotatingReferenceFrameTest()
       : period_(10 * π * sqrt(5.0 / 7.0) * Second),
         solar_system_(SOLUTION_DIR / "astronomy" /
@@ -188,6 +226,66 @@ TEST_F(BarycentricRotatingReferenceFrameTest, Inverse) {
   }
 }
 
+TEST_F(BarycentricRotatingReferenceFrameTest, Memoization) {
+  // A frame that has not memoized anything yet.
+  BarycentricRotatingReferenceFrame<ICRS, BigSmallFrame> const fresh_frame(
+      ephemeris_.get(), big_, small_);
+  std::vector<Instant> times;
+  for (int i = 0; i < 7; ++i) {
+    times.push_back(t0_ + i * period_ / 7);
+  }
+  std::vector<DegreesOfFreedom<BigSmallFrame>> expected;
+  for (Instant const& t : times) {
+    expected.push_back(
+        fresh_frame.ToThisFrameAtTime(t)(small_initial_state_));
+  }
+
+  // Cycle through more instants than are memoized, from several threads, and
+  // check that the results are bit-for-bit identical.
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([this, &expected, &times]() {
+      for (int j = 0; j < 100; ++j) {
+        for (std::size_t k = 0; k < times.size(); ++k) {
+          EXPECT_EQ(expected[k],
+                    big_small_frame_->ToThisFrameAtTime(times[k])(
+                        small_initial_state_));
+          EXPECT_EQ(expected[k],
+                    big_small_frame_->ToThisFrameAtTime(times[k])(
+                        small_initial_state_));
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  // Repeated requests for a few instants only compute the motions once.
+  CountingReferenceFrame const counting_frame(
+      ephemeris_.get(), big_, small_, &fresh_frame);
+  for (int i = 0; i < 100; ++i) {
+    for (std::size_t k = 0; k < 3; ++k) {
+      EXPECT_EQ(expected[k],
+                counting_frame.CountingToThisFrameAtTime(times[k])(
+                    small_initial_state_));
+    }
+  }
+  EXPECT_EQ(3, counting_frame.computations());
+
+  // Older instants are evicted and computed again.
+  for (std::size_t k = 3; k < times.size(); ++k) {
+    EXPECT_EQ(expected[k],
+              counting_frame.CountingToThisFrameAtTime(times[k])(
+                  small_initial_state_));
+  }
+  EXPECT_EQ(7, counting_frame.computations());
+  EXPECT_EQ(expected[0],
+            counting_frame.CountingToThisFrameAtTime(times[0])(
+                small_initial_state_));
+  EXPECT_EQ(8, counting_frame.computations());
+}
+
 TEST_F(BarycentricRotatingReferenceFrameTest, GeometricAcceleration) {
   Instant const t = t0_ + period_;
   DegreesOfFreedom<BigSmallFrame> const point_dof =
@@ -106,21 +106,32 @@ template<typename InertialFrame, typename ThisFrame>
 RigidMotion<InertialFrame, ThisFrame>
 BodyCentredBodyDirectionReferenceFrame<InertialFrame, ThisFrame>::
 ToThisFrameAtTime(Instant const& t) const {
-  DegreesOfFreedom<InertialFrame> const primary_degrees_of_freedom =
-      primary_trajectory_().EvaluateDegreesOfFreedom(t);
-  DegreesOfFreedom<InertialFrame> const secondary_degrees_of_freedom =
-      secondary_trajectory_->EvaluateDegreesOfFreedom(t);
+  auto const compute = [this, &t]() {
+    DegreesOfFreedom<InertialFrame> const primary_degrees_of_freedom =
+        primary_trajectory_().EvaluateDegreesOfFreedom(t);
+    DegreesOfFreedom<InertialFrame> const secondary_degrees_of_freedom =
+        secondary_trajectory_->EvaluateDegreesOfFreedom(t);
 
-  Vector<Acceleration, InertialFrame> const primary_acceleration =
-      compute_gravitational_acceleration_on_primary_(
-          primary_degrees_of_freedom.position(), t);
-  Vector<Acceleration, InertialFrame> const secondary_acceleration =
-      ephemeris_->ComputeGravitationalAccelerationOnMassiveBody(secondary_, t);
+    Vector<Acceleration, InertialFrame> const primary_acceleration =
+        compute_gravitational_acceleration_on_primary_(
+            primary_degrees_of_freedom.position(), t);
+    Vector<Acceleration, InertialFrame> const secondary_acceleration =
+        ephemeris_->ComputeGravitationalAccelerationOnMassiveBody(secondary_,
+                                                                  t);
 
-  return ToThisFrame(primary_degrees_of_freedom,
-                     secondary_degrees_of_freedom,
-                     primary_acceleration,
-                     secondary_acceleration);
+    return ToThisFrame(primary_degrees_of_freedom,
+                       secondary_degrees_of_freedom,
+                       primary_acceleration,
+                       secondary_acceleration);
+  };
+  // A primary that is not a massive body has a trajectory that may change
+  // (e.g., a prediction that gets recomputed), so its motion at a given time
+  // may not be memoized.
+  if (primary_ == nullptr) {
+    return compute();
+  } else {
+    return this->MemoizedToThisFrameAtTime(t, compute);
+  }
 }
 
 template<typename InertialFrame, typename ThisFrame>
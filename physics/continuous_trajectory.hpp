@@ -1,7 +1,10 @@
 #pragma once
 
+#include <cstdint>
+#include <list>
 #include <memory>
 #include <optional>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -55,8 +58,12 @@ class ContinuousTrajectory : public Trajectory<Frame> {
   // multiple of the coefficient of highest degree (assuming that the series
   // converges reasonably well).  Thus, we pick the degree of the series so that
   // the coefficient of highest degree is less than |tolerance|.
+  // If |cold_horizon| is finite, the polynomials that end more than
+  // |cold_horizon| before |t_max()| are compressed losslessly and decompressed
+  // on demand, see |ColdBlock|.
   ContinuousTrajectory(Time const& step,
-                       Length const& tolerance);
+                       Length const& tolerance,
+                       Time const& cold_horizon = Infinity<Time>);
 
   ContinuousTrajectory(ContinuousTrajectory const&) = delete;
   ContinuousTrajectory(ContinuousTrajectory&&) = delete;
@@ -171,17 +178,41 @@ class ContinuousTrajectory : public Trajectory<Frame> {
   // never need to extract their |t_min|.  Logically, the |t_min| for a
   // polynomial is the |t_max| of the previous one.  The first polynomial has a
   // |t_min| which is |*first_time_|.
+  struct ColdBlock;
   struct InstantPolynomialPair {
     InstantPolynomialPair(
         Instant t_max,
         not_null<std::unique_ptr<Polynomial<Position<Frame>, Instant>>>
             polynomial);
     Instant t_max;
-    not_null<std::unique_ptr<Polynomial<Position<Frame>, Instant>>>
-        polynomial;
+    // Null iff the polynomial is cold, in which case it is the polynomial at
+    // |index_in_cold_block| in |cold_block|.
+    std::unique_ptr<Polynomial<Position<Frame>, Instant>> polynomial;
+    std::shared_ptr<ColdBlock const> cold_block;
+    std::int32_t index_in_cold_block = 0;
   };
   using InstantPolynomialPairs = std::vector<InstantPolynomialPair>;
 
+  // A run of consecutive polynomials that are old enough that they are rarely
+  // evaluated.  Each polynomial is represented by its serialized message, split
+  // into a skeleton, where all the doubles are zero, and the doubles
+  // themselves.  The skeletons are shared by the polynomials of the same degree
+  // and the doubles are compressed by zfp in reversible mode, so the
+  // decompression yields the exact same polynomials.
+  struct ColdBlock {
+    std::vector<std::string> skeletons;
+    // The index in |skeletons| of the skeleton of each polynomial.
+    std::vector<std::int8_t> skeleton_indices;
+    // The doubles are stored by columns: the doubles at index i in the
+    // skeletons are contiguous, and the polynomials that have fewer than i
+    // doubles are padded with zeroes.
+    std::int64_t doubles_per_polynomial = 0;
+    std::string zfp;
+  };
+  using ColdPolynomials =
+      std::vector<not_null<std::unique_ptr<Polynomial<Position<Frame>,
+                                                      Instant>>>>;
+
   // Really a static method, but may be overridden for testing.
   virtual not_null<std::unique_ptr<Polynomial<Position<Frame>, Instant>>>
   NewhallApproximationInMonomialBasis(
@@ -204,14 +235,36 @@ class ContinuousTrajectory : public Trajectory<Frame> {
   // Returns an iterator to the polynomial applicable for the given |time|, or
   // |begin| if |time| is before the first polynomial or |end| if |time| is
   // after the last polynomial.  If |time| is the |t_max| of some polynomial,
-  // that polynomial is returned.  Time complexity is O(N Log N).
+  // that polynomial is returned.  Time complexity is O(1) when the polynomials
+  // are equally spaced, which is normally the case, O(Log N) otherwise.
   typename InstantPolynomialPairs::const_iterator
   FindPolynomialForInstantLocked(Instant const& time) const
       REQUIRES_SHARED(lock_);
 
+  // Returns the polynomial of |pair|, decompressing its block if it is cold.
+  // The polynomial remains valid as long as the result is alive, even if it is
+  // evicted from the cache.
+  std::shared_ptr<Polynomial<Position<Frame>, Instant> const>
+  GetPolynomialLocked(InstantPolynomialPair const& pair) const
+      REQUIRES_SHARED(lock_) EXCLUDES(cold_cache_lock_);
+
+  // Compresses the polynomials that end more than |cold_horizon_| before the
+  // last one, by blocks of |polynomials_per_cold_block|.
+  void FreezeOldPolynomials() REQUIRES(lock_);
+
+  // Returns a block compressing the hot polynomials in [begin, end[.
+  not_null<std::shared_ptr<ColdBlock const>> Freeze(
+      typename InstantPolynomialPairs::const_iterator begin,
+      typename InstantPolynomialPairs::const_iterator end) const
+      REQUIRES_SHARED(lock_);
+
+  // Reconstructs the polynomials of |cold_block|.
+  ColdPolynomials Thaw(ColdBlock const& cold_block) const;
+
   // Construction parameters;
   Time const step_;
   Length const tolerance_;
+  Time const cold_horizon_;
   not_null<
       std::unique_ptr<Checkpointer<serialization::ContinuousTrajectory>>>
       checkpointer_;
@@ -230,23 +283,11 @@ class ContinuousTrajectory : public Trajectory<Frame> {
 
   // The polynomials are in increasing time order.
   InstantPolynomialPairs polynomials_ GUARDED_BY(lock_);
+  // All the polynomials before this index are cold.  Those after it are
+  // normally hot, except after a |Prepend|.
+  std::int64_t first_hot_polynomial_ GUARDED_BY(lock_) = 0;
   Policy polynomial_evaluator_policy_;
 
-  // Lookups into |polynomials_| are expensive because they entail a binary
-  // search into a vector that grows over time.  In benchmarks, this can be as
-  // costly as the polynomial evaluation itself.  The accesses are not random,
-  // though, they are clustered in time and (slowly) increasing.  To take
-  // advantage of this, we keep track of the index of the last accessed
-  // polynomial and first try to see if the new lookup is for the same
-  // polynomial.  This makes us O(1) instead of O(Log N) most of the time and it
-  // speeds up the lookup by a factor of 7.  This member is mutable to maintain
-  // the fiction that evaluation has no side effects.  In the presence of
-  // multithreading it may be that different threads would want to access
-  // polynomials at different indices, but by and large the threads progress in
-  // parallel, and benchmarks show that there is no adverse performance effects.
-  // Any value in the range of |polynomials_| or 0 is correct.
-  mutable std::int64_t last_accessed_polynomial_ GUARDED_BY(lock_) = 0;
-
   // The time at which this trajectory starts.  Set for a nonempty trajectory.
   std::optional<Instant> first_time_ GUARDED_BY(lock_);
 
@@ -256,6 +297,13 @@ class ContinuousTrajectory : public Trajectory<Frame> {
   std::vector<std::pair<Instant, DegreesOfFreedom<Frame>>> last_points_
       GUARDED_BY(lock_);
 
+  // The most recently thawed blocks, most recent first.  This cache is mutated
+  // by the readers, hence its own lock.
+  mutable absl::Mutex cold_cache_lock_ ACQUIRED_AFTER(lock_);
+  mutable std::list<std::pair<std::shared_ptr<ColdBlock const>,
+                              std::shared_ptr<ColdPolynomials const>>>
+      cold_cache_ GUARDED_BY(cold_cache_lock_);
+
   friend class TestableContinuousTrajectory<Frame>;
 };
 
@@ -3,15 +3,23 @@
 #include "physics/continuous_trajectory.hpp"
 
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <optional>
 #include <sstream>
+#include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
+#include "base/zfp_compressor.hpp"
 #include "geometry/interval.hpp"
 #include "glog/stl_logging.h"
+#include "google/protobuf/descriptor.h"
+#include "google/protobuf/message.h"
 #include "numerics/newhall.hpp"
 #include "numerics/poisson_series.hpp"
 #include "numerics/polynomial_in_чебышёв_basis.hpp"
@@ -23,6 +31,7 @@ namespace physics {
 namespace _continuous_trajectory {
 namespace internal {
 
+using namespace principia::base::_zfp_compressor;
 using namespace principia::geometry::_interval;
 using namespace principia::numerics::_newhall;
 using namespace principia::numerics::_poisson_series;
@@ -37,11 +46,53 @@ int const max_degree_age = 100;
 // Only supports 8 divisions for now.
 int const divisions = 8;
 
+int const polynomials_per_cold_block = 64;
+int const max_thawed_cold_blocks = 16;
+
+// Calls |f| on a reference to each of the doubles of |message|, recursively, in
+// an order that only depends on the structure of |message|.  The modifications
+// made by |f| are written back to |message|.
+template<typename F>
+void ForAllDoubles(google::protobuf::Message& message, F const& f) {
+  using google::protobuf::FieldDescriptor;
+  auto const* const reflection = message.GetReflection();
+  std::vector<FieldDescriptor const*> fields;
+  reflection->ListFields(message, &fields);
+  for (auto const* const field : fields) {
+    if (field->cpp_type() == FieldDescriptor::CPPTYPE_DOUBLE) {
+      if (field->is_repeated()) {
+        int const size = reflection->FieldSize(message, field);
+        for (int i = 0; i < size; ++i) {
+          double d = reflection->GetRepeatedDouble(message, field, i);
+          f(d);
+          reflection->SetRepeatedDouble(&message, field, i, d);
+        }
+      } else {
+        double d = reflection->GetDouble(message, field);
+        f(d);
+        reflection->SetDouble(&message, field, d);
+      }
+    } else if (field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE) {
+      if (field->is_repeated()) {
+        int const size = reflection->FieldSize(message, field);
+        for (int i = 0; i < size; ++i) {
+          ForAllDoubles(*reflection->MutableRepeatedMessage(&message, field, i),
+                        f);
+        }
+      } else {
+        ForAllDoubles(*reflection->MutableMessage(&message, field), f);
+      }
+    }
+  }
+}
+
 template<typename Frame>
 ContinuousTrajectory<Frame>::ContinuousTrajectory(Time const& step,
-                                                  Length const& tolerance)
+                                                  Length const& tolerance,
+                                                  Time const& cold_horizon)
     : step_(step),
       tolerance_(tolerance),
+      cold_horizon_(cold_horizon),
       checkpointer_(
           make_not_null_unique<
               Checkpointer<serialization::ContinuousTrajectory>>(
@@ -53,6 +104,7 @@ ContinuousTrajectory<Frame>::ContinuousTrajectory(Time const& step,
       degree_age_(0),
       polynomial_evaluator_policy_(Policy::AlwaysEstrin()) {
   CHECK_LT(0 * Metre, tolerance_);
+  CHECK_LE(0 * Second, cold_horizon_);
 }
 
 template<typename Frame>
@@ -69,7 +121,7 @@ double ContinuousTrajectory<Frame>::average_degree() const {
   } else {
     double total = 0;
     for (auto const& pair : polynomials_) {
-      total += pair.polynomial->degree();
+      total += GetPolynomialLocked(pair)->degree();
     }
     return total / polynomials_.size();
   }
@@ -112,6 +164,7 @@ absl::Status ContinuousTrajectory<Frame>::Append(
     v.push_back(degrees_of_freedom.velocity());
 
     status = ComputeBestNewhallApproximation(time, q, v);
+    FreezeOldPolynomials();
 
     // Wipe-out the points that have just been incorporated in a polynomial.
     last_points_.clear();
@@ -143,7 +196,7 @@ void ContinuousTrajectory<Frame>::Prepend(ContinuousTrajectory&& prefix) {
     degree_ = prefix.degree_;
     degree_age_ = prefix.degree_age_;
     polynomials_ = std::move(prefix.polynomials_);
-    last_accessed_polynomial_ = prefix.last_accessed_polynomial_;
+    first_hot_polynomial_ = prefix.first_hot_polynomial_;
     first_time_ = prefix.first_time_;
     last_points_ = prefix.last_points_;
   } else {
@@ -158,6 +211,9 @@ void ContinuousTrajectory<Frame>::Prepend(ContinuousTrajectory&& prefix) {
               polynomials_.end(),
               std::back_inserter(prefix.polynomials_));
     polynomials_.swap(prefix.polynomials_);
+    // The cold polynomials of this object are now after the hot ones of
+    // |prefix|, they will be skipped by |FreezeOldPolynomials|.
+    first_hot_polynomial_ = prefix.first_hot_polynomial_;
     first_time_ = prefix.first_time_;
     // Note that any |last_points_| in |prefix| are irrelevant because they
     // correspond to a time interval covered by the first polynomial of this
@@ -211,7 +267,7 @@ int ContinuousTrajectory<Frame>::PiecewisePoissonSeriesDegree(
   auto const it_max = FindPolynomialForInstantLocked(t_max);
   int degree = min_degree;
   for (auto it = it_min;; ++it) {
-    degree = std::max(degree, it->polynomial->degree());
+    degree = std::max(degree, GetPolynomialLocked(*it)->degree());
     if (it == it_max) {
       break;
     }
@@ -308,7 +364,8 @@ ContinuousTrajectory<Frame>::ToPiecewisePoissonSeries(
     Interval<Instant> interval;
     interval.Include(current_t_min);
     interval.Include(current_t_max);
-    auto const polynomial_cast_to_degree = cast_to_degree(it->polynomial.get());
+    auto const polynomial = GetPolynomialLocked(*it);
+    auto const polynomial_cast_to_degree = cast_to_degree(polynomial.get());
     if (result == nullptr) {
       result = std::make_unique<PiecewisePoisson>(
           interval, Poisson(polynomial_cast_to_degree, {{}}));
@@ -343,8 +400,8 @@ void ContinuousTrajectory<Frame>::WriteToMessage(
   // before the oldest checkpoint.
   for (auto const& pair : polynomials_) {
     Instant const& t_max = pair.t_max;
-    auto const& polynomial = pair.polynomial;
     if (t_max <= checkpointer_->oldest_checkpoint()) {
+      auto const polynomial = GetPolynomialLocked(pair);
       auto* const pair = message->add_instant_polynomial_pair();
       t_max.WriteToMessage(pair->mutable_t_max());
       polynomial->WriteToMessage(pair->mutable_polynomial());
@@ -355,6 +412,9 @@ void ContinuousTrajectory<Frame>::WriteToMessage(
   if (first_time_) {
     first_time_->WriteToMessage(message->mutable_first_time());
   }
+  if (cold_horizon_ != Infinity<Time>) {
+    cold_horizon_.WriteToMessage(message->mutable_cold_horizon());
+  }
 }
 
 template<typename Frame>
@@ -387,7 +447,10 @@ ContinuousTrajectory<Frame>::ReadFromMessage(
   not_null<std::unique_ptr<ContinuousTrajectory<Frame>>> continuous_trajectory =
       std::make_unique<ContinuousTrajectory<Frame>>(
           Time::ReadFromMessage(message.step()),
-          Length::ReadFromMessage(message.tolerance()));
+          Length::ReadFromMessage(message.tolerance()),
+          message.has_cold_horizon()
+              ? Time::ReadFromMessage(message.cold_horizon())
+              : Infinity<Time>);
   if (is_pre_cohen) {
     for (auto const& s : message.series()) {
       // Read the polynomial, evaluate it and use the resulting values to build
@@ -525,6 +588,12 @@ ContinuousTrajectory<Frame>::ReadFromMessage(
     CHECK_LE(continuous_trajectory->t_min(), desired_t_min);
   }
 
+  // The polynomials read above are all hot, compress the old ones.
+  {
+    absl::MutexLock l(&continuous_trajectory->lock_);
+    continuous_trajectory->FreezeOldPolynomials();
+  }
+
   return continuous_trajectory;
 }
 
@@ -592,6 +661,7 @@ ContinuousTrajectory<Frame>::MakeCheckpointerReader() {
       // Restore the other members to their state at the time of the checkpoint.
       if (last_points_.empty()) {
         polynomials_.clear();
+        first_hot_polynomial_ = 0;
         first_time_ = std::nullopt;
       } else {
         // Locate the polynomial that ends at the first last_point_.  Note that
@@ -609,12 +679,12 @@ ContinuousTrajectory<Frame>::MakeCheckpointerReader() {
                                return left < right.t_max;
                              });
         polynomials_.erase(it, polynomials_.end());
+        first_hot_polynomial_ = std::min<std::int64_t>(first_hot_polynomial_,
+                                                       polynomials_.size());
         if (polynomials_.empty()) {
           first_time_ = oldest_time;
         }
       }
-      last_accessed_polynomial_ = 0;  // Always a valid value.
-
       return absl::OkStatus();
     };
   } else {
@@ -645,8 +715,8 @@ Position<Frame> ContinuousTrajectory<Frame>::EvaluatePositionLocked(
   CHECK_GE(t_max_locked(), time);
   auto const it = FindPolynomialForInstantLocked(time);
   CHECK(it != polynomials_.end());
-  auto const& polynomial = *it->polynomial;
-  return polynomial(time);
+  auto const polynomial = GetPolynomialLocked(*it);
+  return (*polynomial)(time);
 }
 
 template<typename Frame>
@@ -656,8 +726,8 @@ Velocity<Frame> ContinuousTrajectory<Frame>::EvaluateVelocityLocked(
   CHECK_GE(t_max_locked(), time);
   auto const it = FindPolynomialForInstantLocked(time);
   CHECK(it != polynomials_.end());
-  auto const& polynomial = *it->polynomial;
-  return polynomial.EvaluateDerivative(time);
+  auto const polynomial = GetPolynomialLocked(*it);
+  return polynomial->EvaluateDerivative(time);
 }
 
 template<typename Frame>
@@ -668,14 +738,15 @@ ContinuousTrajectory<Frame>::EvaluateDegreesOfFreedomLocked(
   CHECK_GE(t_max_locked(), time);
   auto const it = FindPolynomialForInstantLocked(time);
   CHECK(it != polynomials_.end());
-  auto const& polynomial = *it->polynomial;
-  return DegreesOfFreedom<Frame>(polynomial(time),
-                                 polynomial.EvaluateDerivative(time));
+  auto const polynomial = GetPolynomialLocked(*it);
+  return DegreesOfFreedom<Frame>((*polynomial)(time),
+                                 polynomial->EvaluateDerivative(time));
 }
 
 template<typename Frame>
 ContinuousTrajectory<Frame>::ContinuousTrajectory()
-    : checkpointer_(
+    : cold_horizon_(Infinity<Time>),
+      checkpointer_(
           make_not_null_unique<
               Checkpointer<serialization::ContinuousTrajectory>>(
           /*reader=*/nullptr,
@@ -815,26 +886,193 @@ typename ContinuousTrajectory<Frame>::InstantPolynomialPairs::const_iterator
 ContinuousTrajectory<Frame>::FindPolynomialForInstantLocked(
     Instant const& time) const {
   // This returns the first polynomial |p| such that |time <= p.t_max|.
-  {
-    auto const begin = polynomials_.begin();
-    auto const it = begin + last_accessed_polynomial_;
-    if (it != polynomials_.end() && time <= it->t_max &&
-        (it == begin || std::prev(it)->t_max < time)) {
+  auto const begin = polynomials_.begin();
+  auto const end = polynomials_.end();
+  if (polynomials_.empty()) {
+    return end;
+  }
+
+  // Lookups into |polynomials_| used to entail a binary search, which in
+  // benchmarks was as costly as the polynomial evaluation itself.  However,
+  // each polynomial covers |divisions| steps starting at |first_time_|, so the
+  // index of the polynomial is obtained by a division.  Because of rounding
+  // errors on the |t_max|, the polynomial may be a neighbour of the one at
+  // that index.  This has no mutable state, so concurrent lookups at very
+  // different times don't interfere with each other.
+  std::int64_t const size = polynomials_.size();
+  double const index =
+      std::floor((time - *first_time_) / (divisions * step_));
+  std::int64_t const guess = !(index > 0) ? 0
+                             : index >= size - 1
+                                 ? size - 1
+                                 : static_cast<std::int64_t>(index);
+  for (std::int64_t i = std::max<std::int64_t>(guess - 1, 0);
+       i <= std::min(guess + 1, size - 1);
+       ++i) {
+    auto const it = begin + i;
+    if (time <= it->t_max && (it == begin || std::prev(it)->t_max < time)) {
       return it;
     }
   }
+
+  // Either |time| is after the last polynomial or the polynomials are not
+  // equally spaced (e.g., because they were read from an old save).
+  return std::lower_bound(begin,
+                          end,
+                          time,
+                          [](InstantPolynomialPair const& left,
+                             Instant const& right) {
+                            return left.t_max < right;
+                          });
+}
+
+template<typename Frame>
+std::shared_ptr<Polynomial<Position<Frame>, Instant> const>
+ContinuousTrajectory<Frame>::GetPolynomialLocked(
+    InstantPolynomialPair const& pair) const {
+  if (pair.polynomial != nullptr) [[likely]] {
+    // A non-owning pointer: the polynomial is owned by |polynomials_|, and no
+    // reference count is touched.
+    return std::shared_ptr<Polynomial<Position<Frame>, Instant> const>(
+        std::shared_ptr<void>(), pair.polynomial.get());
+  }
+
+  std::shared_ptr<ColdPolynomials const> thawed;
   {
-    auto const it =
-        std::lower_bound(polynomials_.begin(),
-                         polynomials_.end(),
-                         time,
-                         [](InstantPolynomialPair const& left,
-                            Instant const& right) {
-                           return left.t_max < right;
-                         });
-    last_accessed_polynomial_ = it - polynomials_.begin();
-    return it;
+    absl::MutexLock l(&cold_cache_lock_);
+    auto const it = std::find_if(
+        cold_cache_.begin(),
+        cold_cache_.end(),
+        [&pair](auto const& entry) { return entry.first == pair.cold_block; });
+    if (it == cold_cache_.end()) {
+      cold_cache_.emplace_front(
+          pair.cold_block,
+          std::make_shared<ColdPolynomials const>(Thaw(*pair.cold_block)));
+      if (cold_cache_.size() > max_thawed_cold_blocks) {
+        cold_cache_.pop_back();
+      }
+    } else {
+      cold_cache_.splice(cold_cache_.begin(), cold_cache_, it);
+    }
+    thawed = cold_cache_.front().second;
+  }
+  Polynomial<Position<Frame>, Instant> const* const polynomial =
+      (*thawed)[pair.index_in_cold_block].get();
+  // The result shares the ownership of the entire thawed block.
+  return std::shared_ptr<Polynomial<Position<Frame>, Instant> const>(
+      std::move(thawed), polynomial);
+}
+
+template<typename Frame>
+void ContinuousTrajectory<Frame>::FreezeOldPolynomials() {
+  lock_.AssertHeld();
+  if (cold_horizon_ == Infinity<Time> || polynomials_.empty()) {
+    return;
+  }
+  Instant const horizon = polynomials_.back().t_max - cold_horizon_;
+  std::int64_t const size = polynomials_.size();
+  for (;;) {
+    // Skip the polynomials that are already cold, e.g., because they come
+    // from a trajectory that was prepended to.
+    while (first_hot_polynomial_ < size &&
+           polynomials_[first_hot_polynomial_].polynomial == nullptr) {
+      ++first_hot_polynomial_;
+    }
+    // Only freeze full blocks, this is the common exit.
+    if (size - first_hot_polynomial_ < polynomials_per_cold_block ||
+        !(polynomials_[first_hot_polynomial_ + polynomials_per_cold_block - 1]
+              .t_max < horizon)) {
+      return;
+    }
+    auto const begin = polynomials_.begin() + first_hot_polynomial_;
+    auto const end = std::find_if(begin,
+                                  begin + polynomials_per_cold_block,
+                                  [](InstantPolynomialPair const& pair) {
+                                    return pair.polynomial == nullptr;
+                                  });
+    std::shared_ptr<ColdBlock const> const cold_block = Freeze(begin, end);
+    std::int32_t index_in_cold_block = 0;
+    for (auto it = begin; it != end; ++it, ++index_in_cold_block) {
+      it->polynomial.reset();
+      it->cold_block = cold_block;
+      it->index_in_cold_block = index_in_cold_block;
+    }
+    first_hot_polynomial_ = end - polynomials_.begin();
+  }
+}
+
+template<typename Frame>
+not_null<std::shared_ptr<
+    typename ContinuousTrajectory<Frame>::ColdBlock const>>
+ContinuousTrajectory<Frame>::Freeze(
+    typename InstantPolynomialPairs::const_iterator const begin,
+    typename InstantPolynomialPairs::const_iterator const end) const {
+  auto cold_block = make_not_null_shared<ColdBlock>();
+
+  // Split the serialized polynomials into their skeletons and their doubles.
+  std::vector<std::vector<double>> doubles;
+  for (auto it = begin; it != end; ++it) {
+    serialization::Polynomial message;
+    it->polynomial->WriteToMessage(&message);
+    auto& polynomial_doubles = doubles.emplace_back();
+    ForAllDoubles(message, [&polynomial_doubles](double& d) {
+      polynomial_doubles.push_back(d);
+      d = 0;
+    });
+    cold_block->doubles_per_polynomial =
+        std::max<std::int64_t>(cold_block->doubles_per_polynomial,
+                               polynomial_doubles.size());
+    std::string skeleton = message.SerializeAsString();
+    auto const skeleton_it = std::find(cold_block->skeletons.begin(),
+                                       cold_block->skeletons.end(),
+                                       skeleton);
+    cold_block->skeleton_indices.push_back(
+        skeleton_it - cold_block->skeletons.begin());
+    if (skeleton_it == cold_block->skeletons.end()) {
+      cold_block->skeletons.push_back(std::move(skeleton));
+    }
+  }
+
+  // Store the doubles by columns as the coefficients of the same rank are
+  // correlated across polynomials.  The compression is reversible.
+  std::int64_t const size = doubles.size();
+  std::vector<double> columns(size * cold_block->doubles_per_polynomial);
+  for (std::int64_t i = 0; i < size; ++i) {
+    std::int64_t const polynomial_size = doubles[i].size();
+    for (std::int64_t j = 0; j < polynomial_size; ++j) {
+      columns[j * size + i] = doubles[i][j];
+    }
+  }
+  ZfpCompressor const compressor(/*accuracy=*/0);
+  compressor.WriteToMessageMultidimensional<1>(
+      columns, check_not_null(&cold_block->zfp));
+  return cold_block;
+}
+
+template<typename Frame>
+typename ContinuousTrajectory<Frame>::ColdPolynomials
+ContinuousTrajectory<Frame>::Thaw(ColdBlock const& cold_block) const {
+  std::int64_t const size = cold_block.skeleton_indices.size();
+  std::vector<double> columns(size * cold_block.doubles_per_polynomial);
+  ZfpCompressor decompressor;
+  std::string_view zfp(cold_block.zfp);
+  decompressor.ReadFromMessageMultidimensional<1>(columns, zfp);
+
+  ColdPolynomials polynomials;
+  polynomials.reserve(size);
+  for (std::int64_t i = 0; i < size; ++i) {
+    serialization::Polynomial message;
+    CHECK(message.ParseFromString(
+        cold_block.skeletons[cold_block.skeleton_indices[i]]));
+    std::int64_t j = 0;
+    ForAllDoubles(message, [&columns, &j, i, size](double& d) {
+      d = columns[j * size + i];
+      ++j;
+    });
+    polynomials.push_back(
+        Polynomial<Position<Frame>, Instant>::ReadFromMessage(message));
   }
+  return polynomials;
 }
 
 }  // namespace internal
@@ -509,6 +509,153 @@ TEST_F(ContinuousTrajectoryTest, Polynomial) {
 #endif
 }
 
+TEST_F(ContinuousTrajectoryTest, RandomAccess) {
+  int const number_of_steps = 8 * 1000;
+  Time const step = 0.1 * Second;
+
+  auto position_function =
+      [this](Instant const t) {
+        return World::origin +
+            Displacement<World>({(t - t0_) * 3 * Metre / Second,
+                                 (t - t0_) * 5 * Metre / Second,
+                                 (t - t0_) * (-2) * Metre / Second});
+      };
+  auto velocity_function =
+      [](Instant const t) {
+        return Velocity<World>({3 * Metre / Second,
+                                5 * Metre / Second,
+                                -2 * Metre / Second});
+      };
+
+  auto const trajectory = std::make_unique<ContinuousTrajectory<World>>(
+                              step,
+                              /*tolerance=*/0.1 * Metre);
+  FillTrajectory(number_of_steps,
+                 step,
+                 position_function,
+                 velocity_function,
+                 t0_,
+                 *trajectory);
+
+  // Jump back and forth across the trajectory, hitting the ends of the
+  // polynomials as well as their interiors.  Since 7919 is prime, this visits
+  // every half-step.
+  int const number_of_half_steps = 2 * ((number_of_steps - 1) / 8) * 8;
+  for (int i = 0; i <= number_of_half_steps; ++i) {
+    int const j = (i * 7919) % (number_of_half_steps + 1);
+    Instant const time =
+        std::min(trajectory->t_min() + j * step / 2, trajectory->t_max());
+    EXPECT_LT((trajectory->EvaluatePosition(time) - position_function(time))
+                  .Norm(),
+              1 * Milli(Metre))
+        << time;
+  }
+}
+
+TEST_F(ContinuousTrajectoryTest, ColdPolynomials) {
+  int const number_of_steps = 8 * 1000;
+  Time const step = 0.1 * Second;
+  Length const tolerance = 1 * Milli(Metre);
+  AngularFrequency const ω = 0.01 * Radian / Second;
+
+  auto position_function =
+      [this, ω](Instant const t) {
+        return World::origin +
+            Displacement<World>({1 * Kilo(Metre) * Cos(ω * (t - t0_)),
+                                 1 * Kilo(Metre) * Sin(ω * (t - t0_)),
+                                 (t - t0_) * 5 * Metre / Second});
+      };
+  auto velocity_function =
+      [this, ω](Instant const t) {
+        return Velocity<World>(
+            {-1 * Kilo(Metre) * ω * Sin(ω * (t - t0_)) / Radian,
+             1 * Kilo(Metre) * ω * Cos(ω * (t - t0_)) / Radian,
+             5 * Metre / Second});
+      };
+
+  auto const hot_trajectory = std::make_unique<ContinuousTrajectory<World>>(
+      step, tolerance, /*cold_horizon=*/Infinity<Time>);
+  auto const cold_trajectory = std::make_unique<ContinuousTrajectory<World>>(
+      step, tolerance, /*cold_horizon=*/10 * Second);
+  FillTrajectory(number_of_steps,
+                 step,
+                 position_function,
+                 velocity_function,
+                 t0_,
+                 *hot_trajectory);
+  FillTrajectory(number_of_steps,
+                 step,
+                 position_function,
+                 velocity_function,
+                 t0_,
+                 *cold_trajectory);
+  EXPECT_EQ(hot_trajectory->t_min(), cold_trajectory->t_min());
+  EXPECT_EQ(hot_trajectory->t_max(), cold_trajectory->t_max());
+
+  // Most of the polynomials are cold and are thawed through the cache, which
+  // is much smaller than the trajectory.  The compression is lossless.
+  for (Instant time = cold_trajectory->t_min();
+       time <= cold_trajectory->t_max();
+       time += step / 2) {
+    EXPECT_EQ(hot_trajectory->EvaluateDegreesOfFreedom(time),
+              cold_trajectory->EvaluateDegreesOfFreedom(time))
+        << time;
+  }
+
+  // The trajectory is continuous at the boundaries of the cold blocks, which
+  // are 64 polynomials of 8 steps each.
+  Time const δt = step / 1e6;
+  for (Instant time = cold_trajectory->t_min() + 64 * 8 * step;
+       time < cold_trajectory->t_max();
+       time += 64 * 8 * step) {
+    for (Instant const t : {time - δt, time, time + δt}) {
+      EXPECT_EQ(hot_trajectory->EvaluateDegreesOfFreedom(t),
+                cold_trajectory->EvaluateDegreesOfFreedom(t))
+          << t;
+    }
+    EXPECT_LT((cold_trajectory->EvaluatePosition(time + δt) -
+               cold_trajectory->EvaluatePosition(time - δt)).Norm(),
+              2 * tolerance)
+        << time;
+  }
+
+  // The cold polynomials are saved exactly, together with the horizon, and a
+  // reloaded trajectory evaluates to the same values.
+  hot_trajectory->WriteToCheckpoint(hot_trajectory->t_max());
+  cold_trajectory->WriteToCheckpoint(cold_trajectory->t_max());
+  serialization::ContinuousTrajectory hot_message;
+  serialization::ContinuousTrajectory cold_message;
+  hot_trajectory->WriteToMessage(&hot_message);
+  cold_trajectory->WriteToMessage(&cold_message);
+  EXPECT_FALSE(hot_message.has_cold_horizon());
+  EXPECT_EQ(10 * Second, Time::ReadFromMessage(cold_message.cold_horizon()));
+  {
+    serialization::ContinuousTrajectory cold_message_without_horizon =
+        cold_message;
+    cold_message_without_horizon.clear_cold_horizon();
+    EXPECT_THAT(cold_message_without_horizon, EqualsProto(hot_message));
+  }
+
+  auto const cold_trajectory_read =
+      ContinuousTrajectory<World>::ReadFromMessage(
+          /*desired_t_min=*/InfiniteFuture,
+          cold_message);
+  EXPECT_EQ(cold_trajectory->t_min(), cold_trajectory_read->t_min());
+  EXPECT_EQ(cold_trajectory->t_max(), cold_trajectory_read->t_max());
+  for (Instant time = cold_trajectory->t_min();
+       time <= cold_trajectory->t_max();
+       time += step / 2) {
+    EXPECT_EQ(cold_trajectory->EvaluateDegreesOfFreedom(time),
+              cold_trajectory_read->EvaluateDegreesOfFreedom(time))
+        << time;
+  }
+
+  // The reloaded trajectory keeps its horizon, so it is saved identically.
+  serialization::ContinuousTrajectory cold_message_read;
+  cold_trajectory_read->WriteToMessage(&cold_message_read);
+  EXPECT_THAT(cold_message_read, EqualsProto(cold_message));
+}
+
 // An approximation to the trajectory of Io.
 TEST_F(ContinuousTrajectoryTest, Io) {
   int const number_of_steps = 200;
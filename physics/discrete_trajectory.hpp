@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <iterator>
 #include <list>
 #include <memory>
@@ -125,6 +126,18 @@ class DiscreteTrajectory : public Trajectory<Frame> {
   DegreesOfFreedom<Frame> EvaluateDegreesOfFreedom(
       Instant const& t) const override;
 
+  // Range evaluations, see |DiscreteTrajectorySegment|.  The times may span
+  // several segments.
+  template<typename InstantIterator, typename PositionIterator>
+  void EvaluatePositions(InstantIterator begin,
+                         InstantIterator end,
+                         PositionIterator positions) const;
+  template<typename InstantIterator, typename DegreesOfFreedomIterator>
+  void EvaluateDegreesOfFreedom(
+      InstantIterator begin,
+      InstantIterator end,
+      DegreesOfFreedomIterator degrees_of_freedom) const;
+
   // The segments in |tracked| are restored at deserialization.  The points
   // denoted by |exact| are written and re-read exactly and are not affected by
   // any errors introduced by zfp compression.  The endpoints of each segment
@@ -171,6 +184,17 @@ class DiscreteTrajectory : public Trajectory<Frame> {
   typename SegmentByLeftEndpoint::const_iterator
   FindSegment(Instant const& t) const;
 
+  // Splits [begin, end[ into the runs of times that |FindSegment| maps to the
+  // same segment, and calls |evaluate_segment(segment, run_begin, run_end,
+  // output)| for each of them, advancing |output| past each run.
+  template<typename InstantIterator,
+           typename OutputIterator,
+           typename EvaluateSegment>
+  void EvaluateRange(InstantIterator begin,
+                     InstantIterator end,
+                     OutputIterator output,
+                     EvaluateSegment const& evaluate_segment) const;
+
   // Determines if this objects is in a consistent state, and returns an error
   // status with a relevant message if it isn't.
   absl::Status ConsistencyStatus() const;
@@ -495,6 +495,40 @@ DegreesOfFreedom<Frame> DiscreteTrajectory<Frame>::EvaluateDegreesOfFreedom(
   return FindSegment(t)->second->EvaluateDegreesOfFreedom(t);
 }
 
+template<typename Frame>
+template<typename InstantIterator, typename PositionIterator>
+void DiscreteTrajectory<Frame>::EvaluatePositions(
+    InstantIterator const begin,
+    InstantIterator const end,
+    PositionIterator const positions) const {
+  EvaluateRange(begin,
+                end,
+                positions,
+                [](DiscreteTrajectorySegment<Frame> const& segment,
+                   InstantIterator const run_begin,
+                   InstantIterator const run_end,
+                   PositionIterator const output) {
+                  segment.EvaluatePositions(run_begin, run_end, output);
+                });
+}
+
+template<typename Frame>
+template<typename InstantIterator, typename DegreesOfFreedomIterator>
+void DiscreteTrajectory<Frame>::EvaluateDegreesOfFreedom(
+    InstantIterator const begin,
+    InstantIterator const end,
+    DegreesOfFreedomIterator const degrees_of_freedom) const {
+  EvaluateRange(begin,
+                end,
+                degrees_of_freedom,
+                [](DiscreteTrajectorySegment<Frame> const& segment,
+                   InstantIterator const run_begin,
+                   InstantIterator const run_end,
+                   DegreesOfFreedomIterator const output) {
+                  segment.EvaluateDegreesOfFreedom(run_begin, run_end, output);
+                });
+}
+
 template<typename Frame>
 void DiscreteTrajectory<Frame>::WriteToMessage(
     not_null<serialization::DiscreteTrajectory*> message,
@@ -708,6 +742,36 @@ DiscreteTrajectory<Frame>::FindSegment(
   }
 }
 
+template<typename Frame>
+template<typename InstantIterator,
+         typename OutputIterator,
+         typename EvaluateSegment>
+void DiscreteTrajectory<Frame>::EvaluateRange(
+    InstantIterator const begin,
+    InstantIterator const end,
+    OutputIterator output,
+    EvaluateSegment const& evaluate_segment) const {
+  auto run_begin = begin;
+  while (run_begin != end) {
+    auto const sit = FindSegment(*run_begin);
+    CHECK(sit != segment_by_left_endpoint_.cend()) << *run_begin;
+    auto const next_sit = std::next(sit);
+
+    // The run extends up to the left endpoint of the next segment, excluded.
+    auto run_end = run_begin;
+    std::int64_t run_size = 0;
+    while (run_end != end &&
+           (next_sit == segment_by_left_endpoint_.cend() ||
+            *run_end < next_sit->first)) {
+      ++run_end;
+      ++run_size;
+    }
+    evaluate_segment(*sit->second, run_begin, run_end, output);
+    std::advance(output, run_size);
+    run_begin = run_end;
+  }
+}
+
 template<typename Frame>
 absl::Status DiscreteTrajectory<Frame>::ConsistencyStatus() const {
   if (segments_->size() < segment_by_left_endpoint_.size()) {
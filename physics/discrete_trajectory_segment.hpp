@@ -110,6 +110,23 @@ class DiscreteTrajectorySegment : public Trajectory<Frame> {
   DegreesOfFreedom<Frame> EvaluateDegreesOfFreedom(
       Instant const& t) const override;
 
+  // Evaluates this segment at the times in [begin, end[, which must be sorted
+  // in increasing order and lie in [t_min(), t_max()], and writes the results
+  // to the caller-provided range starting at |positions| (resp.
+  // |degrees_of_freedom|).  Equivalent to calling |EvaluatePosition| (resp.
+  // |EvaluateDegreesOfFreedom|) for each time, but much faster when the times
+  // are dense: the timeline is walked once instead of being searched for each
+  // time, and each interpolation is reused for all the times in its interval.
+  template<typename InstantIterator, typename PositionIterator>
+  void EvaluatePositions(InstantIterator begin,
+                         InstantIterator end,
+                         PositionIterator positions) const;
+  template<typename InstantIterator, typename DegreesOfFreedomIterator>
+  void EvaluateDegreesOfFreedom(
+      InstantIterator begin,
+      InstantIterator end,
+      DegreesOfFreedomIterator degrees_of_freedom) const;
+
   // This segment must have 0 or 1 points.  Occasionally removes intermediate
   // points from the segment when |Append|ing, ensuring that positions remain
   // within the desired tolerance.
@@ -198,6 +215,25 @@ class DiscreteTrajectorySegment : public Trajectory<Frame> {
   Hermite3<Position<Frame>, Instant> GetInterpolation(
       typename Timeline::const_iterator upper) const;
 
+  // The implementation of the range evaluations.  For each time in [begin,
+  // end[, writes to |output| the result of |exact| on the degrees of freedom of
+  // the timeline at that time, if any, or else the result of |interpolate| on
+  // the interpolation for the interval containing that time and the time.
+  template<typename InstantIterator,
+           typename OutputIterator,
+           typename Exact,
+           typename Interpolate>
+  void EvaluateRange(InstantIterator begin,
+                     InstantIterator end,
+                     OutputIterator output,
+                     Exact const& exact,
+                     Interpolate const& interpolate) const;
+
+  // When walking the timeline to find the interval containing a time, the
+  // number of points that we are willing to skip before falling back to a
+  // binary search.
+  static constexpr int max_points_skipped_by_walk = 8;
+
   typename Timeline::const_iterator timeline_begin() const;
   typename Timeline::const_iterator timeline_end() const;
   bool timeline_empty() const;
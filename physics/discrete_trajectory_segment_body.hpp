@@ -169,6 +169,47 @@ DiscreteTrajectorySegment<Frame>::EvaluateDegreesOfFreedom(
   return {interpolation.Evaluate(t), interpolation.EvaluateDerivative(t)};
 }
 
+template<typename Frame>
+template<typename InstantIterator, typename PositionIterator>
+void DiscreteTrajectorySegment<Frame>::EvaluatePositions(
+    InstantIterator const begin,
+    InstantIterator const end,
+    PositionIterator const positions) const {
+  EvaluateRange(
+      begin,
+      end,
+      positions,
+      /*exact=*/[](DegreesOfFreedom<Frame> const& degrees_of_freedom) {
+        return degrees_of_freedom.position();
+      },
+      /*interpolate=*/
+      [](Hermite3<Position<Frame>, Instant> const& interpolation,
+         Instant const& t) {
+        return interpolation.Evaluate(t);
+      });
+}
+
+template<typename Frame>
+template<typename InstantIterator, typename DegreesOfFreedomIterator>
+void DiscreteTrajectorySegment<Frame>::EvaluateDegreesOfFreedom(
+    InstantIterator const begin,
+    InstantIterator const end,
+    DegreesOfFreedomIterator const degrees_of_freedom) const {
+  EvaluateRange(
+      begin,
+      end,
+      degrees_of_freedom,
+      /*exact=*/[](DegreesOfFreedom<Frame> const& exact_degrees_of_freedom) {
+        return exact_degrees_of_freedom;
+      },
+      /*interpolate=*/
+      [](Hermite3<Position<Frame>, Instant> const& interpolation,
+         Instant const& t) {
+        return DegreesOfFreedom<Frame>(interpolation.Evaluate(t),
+                                       interpolation.EvaluateDerivative(t));
+      });
+}
+
 template<typename Frame>
 void DiscreteTrajectorySegment<Frame>::SetDownsampling(
     DownsamplingParameters const& downsampling_parameters) {
@@ -588,6 +629,63 @@ DiscreteTrajectorySegment<Frame>::GetInterpolation(
        upper_degrees_of_freedom.velocity()}};
 }
 
+template<typename Frame>
+template<typename InstantIterator,
+         typename OutputIterator,
+         typename Exact,
+         typename Interpolate>
+void DiscreteTrajectorySegment<Frame>::EvaluateRange(
+    InstantIterator const begin,
+    InstantIterator const end,
+    OutputIterator output,
+    Exact const& exact,
+    Interpolate const& interpolate) const {
+  if (begin == end) {
+    return;
+  }
+  CHECK_LE(t_min(), *begin);
+  CHECK_GE(t_max(), *begin);
+
+  // |upper| is the first point of the timeline at or after the current time.
+  // |interpolation| is the interpolation on ]std::prev(upper), upper], if it
+  // has been constructed.
+  auto upper = timeline_.lower_bound(*begin);
+  std::optional<Hermite3<Position<Frame>, Instant>> interpolation;
+  std::optional<Instant> previous_t;
+  for (auto it = begin; it != end; ++it, ++output) {
+    Instant const& t = *it;
+    if (previous_t.has_value()) {
+      DCHECK_LE(*previous_t, t);
+    }
+    previous_t = t;
+
+    if (upper->time < t) {
+      // Walk the timeline for a few points, in case the times are dense, and
+      // fall back to a binary search otherwise.  Note that the walk cannot go
+      // past the last point because |t| is at most |t_max()|.
+      CHECK_GE(t_max(), t);
+      interpolation.reset();
+      int points_skipped = 0;
+      do {
+        ++upper;
+        ++points_skipped;
+      } while (upper->time < t && points_skipped < max_points_skipped_by_walk);
+      if (upper->time < t) {
+        upper = timeline_.lower_bound(t);
+      }
+    }
+
+    if (upper->time == t) {
+      *output = exact(upper->degrees_of_freedom);
+    } else {
+      if (!interpolation.has_value()) {
+        interpolation.emplace(GetInterpolation(upper));
+      }
+      *output = interpolate(*interpolation, t);
+    }
+  }
+}
+
 template<typename Frame>
 typename DiscreteTrajectorySegment<Frame>::Timeline::const_iterator
 DiscreteTrajectorySegment<Frame>::timeline_begin() const {
@@ -235,6 +235,39 @@ TEST_F(DiscreteTrajectorySegmentTest, Evaluate) {
               IsNear(10.4_(1) * Nano(Metre / Second)));
 }
 
+TEST_F(DiscreteTrajectorySegmentTest, EvaluateRange) {
+  auto const segments = MakeSegments(1);
+  auto& circle = *segments->begin();
+  AngularFrequency const ω = 3 * Radian / Second;
+  Length const r = 2 * Metre;
+  Time const Δt = 10 * Milli(Second);
+  Instant const t1 = t0_;
+  Instant const t2 = t0_ + 10 * Second;
+  AppendTrajectoryTimeline(
+      NewCircularTrajectoryTimeline<World>(ω, r, Δt, t1, t2), /*to=*/circle);
+
+  // Dense times, which are found by walking the timeline, and sparse times,
+  // which require a binary search.  Some times coincide with points of the
+  // timeline.
+  for (Time const step : {1 * Milli(Second), 10 * Milli(Second), 1 * Second}) {
+    std::vector<Instant> times;
+    for (Instant t = circle.t_min(); t <= circle.t_max(); t += step) {
+      times.push_back(t);
+    }
+    std::vector<Position<World>> positions(times.size());
+    std::vector<DegreesOfFreedom<World>> degrees_of_freedom(
+        times.size(), {World::origin, World::unmoving});
+    circle.EvaluatePositions(times.begin(), times.end(), positions.begin());
+    circle.EvaluateDegreesOfFreedom(
+        times.begin(), times.end(), degrees_of_freedom.begin());
+    for (int i = 0; i < times.size(); ++i) {
+      EXPECT_EQ(circle.EvaluatePosition(times[i]), positions[i]);
+      EXPECT_EQ(circle.EvaluateDegreesOfFreedom(times[i]),
+                degrees_of_freedom[i]);
+    }
+  }
+}
+
 TEST_F(DiscreteTrajectorySegmentTest, DownsamplingCircle) {
   auto const circle_segments = MakeSegments(1);
   auto const downsampled_circle_segments = MakeSegments(1);
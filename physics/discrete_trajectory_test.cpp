@@ -703,6 +703,33 @@ TEST_F(DiscreteTrajectoryTest, TMinTMaxEvaluate) {
                                         0 * Metre / Second}), 0)));
 }
 
+TEST_F(DiscreteTrajectoryTest, EvaluateRange) {
+  auto const trajectory = MakeTrajectory();
+
+  // The times span the three segments and hit their endpoints.
+  std::vector<Instant> times;
+  for (Instant t = trajectory.t_min();
+       t <= trajectory.t_max();
+       t += 0.25 * Second) {
+    times.push_back(t);
+  }
+
+  std::vector<Position<World>> positions(times.size());
+  trajectory.EvaluatePositions(times.begin(), times.end(), positions.begin());
+  std::vector<DegreesOfFreedom<World>> degrees_of_freedom(
+      times.size(), DegreesOfFreedom<World>(World::origin, World::unmoving));
+  trajectory.EvaluateDegreesOfFreedom(times.begin(),
+                                      times.end(),
+                                      degrees_of_freedom.begin());
+  for (std::size_t i = 0; i < times.size(); ++i) {
+    EXPECT_EQ(trajectory.EvaluatePosition(times[i]), positions[i])
+        << times[i];
+    EXPECT_EQ(trajectory.EvaluateDegreesOfFreedom(times[i]),
+              degrees_of_freedom[i])
+        << times[i];
+  }
+}
+
 TEST_F(DiscreteTrajectoryTest, SerializationRoundTrip) {
   auto const trajectory = MakeTrajectory();
   auto const trajectory_first_segment = trajectory.segments().begin();
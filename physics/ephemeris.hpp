@@ -94,8 +94,12 @@ class Ephemeris {
 
   class AccuracyParameters final {
    public:
+    // If |cold_horizon| is finite, the polynomials of the trajectories of the
+    // bodies that are older than |cold_horizon| are compressed, see
+    // |ContinuousTrajectory|.
     AccuracyParameters(Length const& fitting_tolerance,
-                       double geopotential_tolerance);
+                       double geopotential_tolerance,
+                       Time const& cold_horizon = Infinity<Time>);
 
     void WriteToMessage(
         not_null<serialization::Ephemeris::AccuracyParameters*> message) const;
@@ -105,6 +109,7 @@ class Ephemeris {
    private:
     Length fitting_tolerance_;
     double geopotential_tolerance_ = 0;
+    Time cold_horizon_;
     friend class Ephemeris<Frame>;
   };
 
@@ -144,7 +149,12 @@ class Ephemeris {
   virtual absl::Status Prolong(
       Instant const& t,
       std::int64_t max_ephemeris_steps = unlimited_max_ephemeris_steps)
-      EXCLUDES(lock_);
+      EXCLUDES(prolong_lock_, lock_);
+
+  // Asks the prolonger thread to asynchronously prolong the ephemeris up to at
+  // least |t|, so that later calls to |Prolong| with a smaller time return
+  // immediately.  The request replaces any pending one.
+  virtual void RequestProlongation(Instant const& t);
 
   // Asks the reanimator thread to asynchronously reconstruct the past so that
   // the |t_min()| of the ephemeris ultimately ends up at or before
@@ -184,7 +194,7 @@ class Ephemeris {
       Instant const& t,
       AdaptiveStepParameters const& parameters,
       std::int64_t max_ephemeris_steps = unlimited_max_ephemeris_steps)
-      EXCLUDES(lock_);
+      EXCLUDES(prolong_lock_, lock_);
 
   // Same as above, but uses a generalized integrator.
   virtual absl::Status FlowWithAdaptiveStep(
@@ -193,7 +203,7 @@ class Ephemeris {
       Instant const& t,
       GeneralizedAdaptiveStepParameters const& parameters,
       std::int64_t max_ephemeris_steps = unlimited_max_ephemeris_steps)
-      EXCLUDES(lock_);
+      EXCLUDES(prolong_lock_, lock_);
 
   // Integrates, until at most |t|, the trajectories followed by massless
   // bodies in the gravitational potential described by |*this|.  If
@@ -270,7 +280,8 @@ class Ephemeris {
       int serialization_index) const;
 
   virtual void WriteToMessage(
-      not_null<serialization::Ephemeris*> message) const EXCLUDES(lock_);
+      not_null<serialization::Ephemeris*> message) const
+      EXCLUDES(prolong_lock_, lock_);
   // The parameter |desired_t_min| indicates that the ephemeris must be restored
   // at a checkpoint such that, once the ephemeris is prolonged, its |t_min()|
   // is at or before |desired_t_min|.
@@ -288,7 +299,7 @@ class Ephemeris {
  private:
   // Checkpointing support.
   void WriteToCheckpointIfNeeded(Instant const& time) const
-      SHARED_LOCKS_REQUIRED(lock_);
+      SHARED_LOCKS_REQUIRED(prolong_lock_, lock_);
   Checkpointer<serialization::Ephemeris>::Writer MakeCheckpointerWriter();
   Checkpointer<serialization::Ephemeris>::Reader MakeCheckpointerReader();
 
@@ -298,6 +309,12 @@ class Ephemeris {
   // the reanimator where to stop.
   absl::Status Reanimate(Instant const desired_t_min) EXCLUDES(lock_);
 
+  // Called on a stoppable thread to prolong the ephemeris up to at least |t|.
+  // The integration is done by small increments so that a concurrent |Prolong|
+  // never has to wait long for |prolong_lock_|.
+  absl::Status ProlongInBackground(Instant const& t)
+      EXCLUDES(prolong_lock_, lock_);
+
   // Reconstructs the past state of the ephemeris between |t_initial| and
   // |t_final| using the given checkpoint |message|.
   absl::Status ReanimateOneCheckpoint(
@@ -308,7 +325,7 @@ class Ephemeris {
   // Callbacks for the integrators.
   void AppendMassiveBodiesState(
       typename NewtonianMotionEquation::State const& state)
-      REQUIRES(lock_);
+      REQUIRES(prolong_lock_) EXCLUDES(lock_);
   template<typename ContinuousTrajectoryPtr>
   static std::vector<absl::Status> AppendMassiveBodiesStateToTrajectories(
       typename NewtonianMotionEquation::State const& state,
@@ -321,7 +338,7 @@ class Ephemeris {
   // ephemeris.
   NewtonianMotionEquation MakeMassiveBodiesNewtonianMotionEquation();
 
-  Instant instance_time_locked() const REQUIRES_SHARED(lock_);
+  Instant instance_time_locked() const REQUIRES_SHARED(prolong_lock_);
 
   virtual Instant t_min_locked() const REQUIRES_SHARED(lock_);
   virtual Instant t_max_locked() const REQUIRES_SHARED(lock_);
@@ -486,17 +503,28 @@ class Ephemeris {
   RecurringThread<Instant> reanimator_;
   Clientele<Instant> reanimator_clientele_;
 
+  // Prolongs the ephemeris ahead of the needs of the callers of |Prolong|.
+  RecurringThread<Instant> prolonger_;
+
   // The fields above this line are fixed at construction and therefore not
-  // protected.  Note that |ContinuousTrajectory| is thread-safe.  |lock_| is
-  // also used to protect sections where the trajectories are not mutually
-  // consistent (e.g., during Prolong).
+  // protected.  Note that |ContinuousTrajectory| is thread-safe.
+
+  // Serializes the integrations of the massive bodies and protects the
+  // |instance_| that performs them.  The readers of the trajectories don't
+  // take this lock, so they are not blocked by a long |Prolong|.
+  mutable absl::Mutex prolong_lock_ ACQUIRED_BEFORE(lock_);
+
+  // Protects the sections where the trajectories are not mutually consistent.
+  // During |Prolong| it is only held exclusively while a state of the massive
+  // bodies is appended to their trajectories, so the readers only wait for the
+  // duration of an append, not of the integration.
   mutable absl::Mutex lock_;
 
   // Parameter passed to the last call to |RequestReanimation|, if any.
   std::optional<Instant> last_desired_t_min_ GUARDED_BY(lock_);
 
   std::unique_ptr<typename Integrator<NewtonianMotionEquation>::Instance>
-      instance_ GUARDED_BY(lock_);
+      instance_ GUARDED_BY(prolong_lock_);
 
   absl::Status last_severe_integration_status_ GUARDED_BY(lock_);
 };
@@ -57,6 +57,9 @@ using namespace std::chrono_literals;
 constexpr Length pre_ἐρατοσθένης_default_ephemeris_fitting_tolerance =
     1 * Milli(Metre);
 constexpr Time max_time_between_checkpoints = 180 * Day;
+// The maximum number of steps integrated by the prolonger thread while holding
+// |prolong_lock_|.
+constexpr std::int64_t max_ephemeris_steps_per_background_prolongation = 100;
 // Below this threshold detect a collision to prevent the integrator and the
 // downsampling from going postal.
 constexpr double min_radius_tolerance = 0.99;
@@ -68,9 +71,11 @@ inline absl::Status CollisionDetected() {
 template<typename Frame>
 Ephemeris<Frame>::AccuracyParameters::AccuracyParameters(
     Length const& fitting_tolerance,
-    double const geopotential_tolerance)
+    double const geopotential_tolerance,
+    Time const& cold_horizon)
     : fitting_tolerance_(fitting_tolerance),
-      geopotential_tolerance_(geopotential_tolerance) {}
+      geopotential_tolerance_(geopotential_tolerance),
+      cold_horizon_(cold_horizon) {}
 
 template<typename Frame>
 void Ephemeris<Frame>::AccuracyParameters::WriteToMessage(
@@ -78,6 +83,9 @@ void Ephemeris<Frame>::AccuracyParameters::WriteToMessage(
     const {
   fitting_tolerance_.WriteToMessage(message->mutable_fitting_tolerance());
   message->set_geopotential_tolerance(geopotential_tolerance_);
+  if (cold_horizon_ != Infinity<Time>) {
+    cold_horizon_.WriteToMessage(message->mutable_cold_horizon());
+  }
 }
 
 template<typename Frame>
@@ -86,7 +94,9 @@ Ephemeris<Frame>::AccuracyParameters::ReadFromMessage(
     serialization::Ephemeris::AccuracyParameters const& message) {
   return AccuracyParameters(
       Length::ReadFromMessage(message.fitting_tolerance()),
-      message.geopotential_tolerance());
+      message.geopotential_tolerance(),
+      message.has_cold_horizon() ? Time::ReadFromMessage(message.cold_horizon())
+                                 : Infinity<Time>);
 }
 
 template<typename Frame>
@@ -107,7 +117,12 @@ Ephemeris<Frame>::Ephemeris(
             return Reanimate(desired_t_min);
           },
           20ms),  // 50 Hz.
-      reanimator_clientele_(/*default_value=*/InfiniteFuture) {
+      reanimator_clientele_(/*default_value=*/InfiniteFuture),
+      prolonger_(
+          [this](Instant const& t) {
+            return ProlongInBackground(t);
+          },
+          20ms) {  // 50 Hz.
   CHECK(!bodies.empty());
   CHECK_EQ(bodies.size(), initial_state.size());
 
@@ -128,7 +143,8 @@ Ephemeris<Frame>::Ephemeris(
         body.get(),
         std::make_unique<ContinuousTrajectory<Frame>>(
             fixed_step_parameters_.step(),
-            accuracy_parameters_.fitting_tolerance_));
+            accuracy_parameters_.fitting_tolerance_,
+            accuracy_parameters_.cold_horizon_));
     CHECK(inserted);
     ContinuousTrajectory<Frame>* const trajectory = it->second.get();
     CHECK_OK(trajectory->Append(initial_time, degrees_of_freedom));
@@ -156,7 +172,7 @@ Ephemeris<Frame>::Ephemeris(
     }
   }
 
-  absl::ReaderMutexLock l(&lock_);  // For locking checks.
+  absl::MutexLock l(&prolong_lock_);  // For locking checks.
   instance_ = fixed_step_parameters_.integrator().NewInstance(
       problem,
       /*append_state=*/std::bind(
@@ -166,6 +182,7 @@ Ephemeris<Frame>::Ephemeris(
 
 template<typename Frame>
 Ephemeris<Frame>::~Ephemeris() {
+  prolonger_.Stop();
   reanimator_.Stop();
 }
 
@@ -216,6 +233,14 @@ absl::Status Ephemeris<Frame>::last_severe_integration_status() const {
   return last_severe_integration_status_;
 }
 
+template<typename Frame>
+void Ephemeris<Frame>::RequestProlongation(Instant const& t) {
+  if (t_max() < t) {
+    prolonger_.Start();
+    prolonger_.Put(t);
+  }
+}
+
 template<typename Frame>
 void Ephemeris<Frame>::RequestReanimation(Instant const& desired_t_min) {
   reanimator_.Start();
@@ -266,7 +291,15 @@ void Ephemeris<Frame>::AwaitReanimation(Instant const& desired_t_min) {
 template<typename Frame>
 absl::Status Ephemeris<Frame>::Prolong(Instant const& t,
                                        std::int64_t const max_ephemeris_steps) {
-  absl::MutexLock l(&lock_);
+  // The fast path, taken most of the time if the prolonger thread is keeping
+  // ahead of the callers.  Don't wait for its integration to complete.
+  if (t_max() >= t) {
+    return absl::OkStatus();
+  }
+
+  // Only the integration is serialized here.  The states are published to the
+  // trajectories under |lock_| by |AppendMassiveBodiesState|.
+  absl::MutexLock l(&prolong_lock_);
   Instant const instance_time = this->instance_time_locked();
 
   // We want |t_max()| to reach at least this point when this function
@@ -288,7 +321,7 @@ absl::Status Ephemeris<Frame>::Prolong(Instant const& t,
   // Perform the integration.  Note that we may have to iterate until |t_max()|
   // actually reaches |desired_t_max| because the last series may not be fully
   // determined after the first integration.
-  while (t_max_locked() < desired_t_max) {
+  while (t_max() < desired_t_max) {
     instance_->Solve(t_final).IgnoreError();
     RETURN_IF_STOPPED;
     t_final += fixed_step_parameters_.step();
@@ -774,7 +807,8 @@ template<typename Frame>
 void Ephemeris<Frame>::WriteToMessage(
     not_null<serialization::Ephemeris*> const message) const {
   LOG(INFO) << __FUNCTION__;
-  absl::ReaderMutexLock l(&lock_);
+  absl::ReaderMutexLock l1(&prolong_lock_);
+  absl::ReaderMutexLock l2(&lock_);
 
   // Make sure that a checkpoint exists, otherwise we would not serialize some
   // parts of the state.
@@ -912,7 +946,8 @@ Ephemeris<Frame>::Ephemeris(
           make_not_null_unique<Checkpointer<serialization::Ephemeris>>(
               /*reader=*/nullptr, /*writer=*/nullptr)),
       reanimator_(/*action=*/nullptr, 0ms),
-      reanimator_clientele_(InfiniteFuture) {}
+      reanimator_clientele_(InfiniteFuture),
+      prolonger_(/*action=*/nullptr, 0ms) {}
 
 template<typename Frame>
 void Ephemeris<Frame>::WriteToCheckpointIfNeeded(Instant const& time) const {
@@ -933,7 +968,7 @@ Ephemeris<Frame>::MakeCheckpointerWriter() {
   if constexpr (serializable<Frame>) {
     return [this](
                not_null<serialization::Ephemeris::Checkpoint*> const message) {
-      lock_.AssertReaderHeld();
+      prolong_lock_.AssertReaderHeld();
       instance_->WriteToMessage(message->mutable_instance());
     };
   } else {
@@ -946,7 +981,7 @@ Checkpointer<serialization::Ephemeris>::Reader
 Ephemeris<Frame>::MakeCheckpointerReader() {
   if constexpr (serializable<Frame>) {
     return [this](serialization::Ephemeris::Checkpoint const& message) {
-      absl::MutexLock l(&lock_);
+      absl::MutexLock l(&prolong_lock_);
       instance_ = FixedStepSizeIntegrator<NewtonianMotionEquation>::Instance::
           ReadFromMessage(
               message.instance(),
@@ -1003,6 +1038,15 @@ absl::Status Ephemeris<Frame>::Reanimate(Instant const desired_t_min) {
   return absl::OkStatus();
 }
 
+template<typename Frame>
+absl::Status Ephemeris<Frame>::ProlongInBackground(Instant const& t) {
+  while (t_max() < t) {
+    RETURN_IF_ERROR(
+        Prolong(t, max_ephemeris_steps_per_background_prolongation));
+  }
+  return absl::OkStatus();
+}
+
 template<typename Frame>
 absl::Status Ephemeris<Frame>::ReanimateOneCheckpoint(
     serialization::Ephemeris::Checkpoint const& message,
@@ -1017,7 +1061,8 @@ absl::Status Ephemeris<Frame>::ReanimateOneCheckpoint(
   for (int i = 0; i < trajectories_.size(); ++i) {
     trajectories.emplace_back(std::make_unique<ContinuousTrajectory<Frame>>(
         fixed_step_parameters_.step(),
-        accuracy_parameters_.fitting_tolerance_));
+        accuracy_parameters_.fitting_tolerance_,
+        accuracy_parameters_.cold_horizon_));
 
     // This statement is subtle: it restores the checkpoints of the trajectories
     // of this ephemeris, but thanks to the newly-created reader, it restores
@@ -1059,7 +1104,8 @@ absl::Status Ephemeris<Frame>::ReanimateOneCheckpoint(
 template<typename Frame>
 void Ephemeris<Frame>::AppendMassiveBodiesState(
     typename NewtonianMotionEquation::State const& state) {
-  lock_.AssertHeld();
+  prolong_lock_.AssertHeld();
+  absl::MutexLock l(&lock_);
 
   // Extend the trajectories.
   auto const statuses = AppendMassiveBodiesStateToTrajectories(state,
@@ -1535,6 +1581,13 @@ absl::Status Ephemeris<Frame>::FlowODEWithAdaptiveStep(
   Prolong(t, max_ephemeris_steps).IgnoreError();
   RETURN_IF_STOPPED;
   Instant const t_final = std::min(t, t_max());
+  if (t_final < t && max_ephemeris_steps != unlimited_max_ephemeris_steps) {
+    // The ephemeris was too short for this flow.  Have it prolonged in the
+    // background by as much as the next flow is allowed to prolong it, so that
+    // the next flow doesn't have to do it.
+    RequestProlongation(std::min(
+        t, t_final + max_ephemeris_steps * fixed_step_parameters_.step()));
+  }
 
   InitialValueProblem<ODE> problem;
   problem.equation.compute_acceleration = std::move(compute_acceleration);
@@ -1543,9 +1596,16 @@ absl::Status Ephemeris<Frame>::FlowODEWithAdaptiveStep(
                            {trajectory_last_degrees_of_freedom.position()},
                            {trajectory_last_degrees_of_freedom.velocity()}};
 
+  // Unless we have a hint, the first step covers the entire flow and is
+  // reduced by the step size controller, which wastes a few rejected steps.
+  Time first_time_step = t_final - problem.initial_state.time.value;
+  if (parameters.first_time_step().has_value()) {
+    first_time_step =
+        std::min(first_time_step, parameters.first_time_step().value());
+  }
   typename AdaptiveStepSizeIntegrator<ODE>::Parameters const
       integrator_parameters(
-          /*first_time_step=*/t_final - problem.initial_state.time.value,
+          first_time_step,
           /*safety_factor=*/0.9,
           parameters.max_steps(),
           /*last_step_is_exact=*/true);
@@ -1,11 +1,14 @@
 #include "physics/ephemeris.hpp"
 
+#include <atomic>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <optional>
 #include <random>
 #include <set>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -203,6 +206,106 @@ TEST_P(EphemerisTest, ProlongSpecialCases) {
   EXPECT_EQ(t_max, ephemeris.t_max());
 }
 
+TEST_P(EphemerisTest, RequestProlongationThenProlong) {
+  std::vector<not_null<std::unique_ptr<MassiveBody const>>> bodies;
+  std::vector<DegreesOfFreedom<ICRS>> initial_state;
+  Position<ICRS> centre_of_mass;
+  Time period;
+  SetUpEarthMoonSystem(bodies, initial_state, centre_of_mass, period);
+
+  Ephemeris<ICRS> ephemeris(
+      std::move(bodies),
+      initial_state,
+      t0_,
+      /*accuracy_parameters=*/{/*fitting_tolerance=*/5 * Milli(Metre),
+                               /*geopotential_tolerance=*/0x1p-24},
+      Ephemeris<ICRS>::FixedStepParameters(integrator(), period / 100));
+  EXPECT_OK(ephemeris.Prolong(t0_));
+
+  // A blocking prolongation, before or beyond the requested time, contends
+  // with the prolonger thread but returns a long enough ephemeris.
+  ephemeris.RequestProlongation(t0_ + 10 * period);
+  EXPECT_OK(ephemeris.Prolong(t0_ + period));
+  EXPECT_LE(t0_ + period, ephemeris.t_max());
+  EXPECT_OK(ephemeris.Prolong(t0_ + 20 * period));
+  EXPECT_LE(t0_ + 20 * period, ephemeris.t_max());
+
+  // Once the ephemeris is long enough, a request is a no-op.
+  Instant const t_max = ephemeris.t_max();
+  ephemeris.RequestProlongation(t0_ + 5 * period);
+  EXPECT_OK(ephemeris.Prolong(t0_ + 5 * period));
+  EXPECT_EQ(t_max, ephemeris.t_max());
+}
+
+TEST_P(EphemerisTest, RequestProlongationThenDestroy) {
+  std::vector<not_null<std::unique_ptr<MassiveBody const>>> bodies;
+  std::vector<DegreesOfFreedom<ICRS>> initial_state;
+  Position<ICRS> centre_of_mass;
+  Time period;
+  SetUpEarthMoonSystem(bodies, initial_state, centre_of_mass, period);
+
+  auto ephemeris = std::make_unique<Ephemeris<ICRS>>(
+      std::move(bodies),
+      initial_state,
+      t0_,
+      /*accuracy_parameters=*/{/*fitting_tolerance=*/5 * Milli(Metre),
+                               /*geopotential_tolerance=*/0x1p-24},
+      Ephemeris<ICRS>::FixedStepParameters(integrator(), period / 100));
+  EXPECT_OK(ephemeris->Prolong(t0_));
+
+  // The destruction stops the prolonger thread in the middle of a long
+  // prolongation without waiting for it to complete.
+  ephemeris->RequestProlongation(t0_ + 1e6 * period);
+  std::this_thread::sleep_for(50ms);
+  ephemeris.reset();
+}
+
+TEST_P(EphemerisTest, RequestProlongationConcurrentReaders) {
+  std::vector<not_null<std::unique_ptr<MassiveBody const>>> bodies;
+  std::vector<DegreesOfFreedom<ICRS>> initial_state;
+  Position<ICRS> centre_of_mass;
+  Time period;
+  SetUpEarthMoonSystem(bodies, initial_state, centre_of_mass, period);
+
+  Ephemeris<ICRS> ephemeris(
+      std::move(bodies),
+      initial_state,
+      t0_,
+      /*accuracy_parameters=*/{/*fitting_tolerance=*/5 * Milli(Metre),
+                               /*geopotential_tolerance=*/0x1p-24},
+      Ephemeris<ICRS>::FixedStepParameters(integrator(), period / 100));
+  EXPECT_OK(ephemeris.Prolong(t0_));
+  Instant const t_final = t0_ + 100 * period;
+  auto const moon = ephemeris.trajectory(ephemeris.bodies()[1]);
+
+  // The readers observe a |t_max| that only moves forward, and they can always
+  // evaluate the trajectories up to the |t_max| that they observed.
+  std::atomic_bool done = false;
+  std::vector<std::thread> readers;
+  for (int i = 0; i < 4; ++i) {
+    readers.emplace_back([&done, &ephemeris, moon, t0 = t0_]() {
+      Instant previous_t_max = ephemeris.t_max();
+      while (!done) {
+        Instant const t_max = ephemeris.t_max();
+        EXPECT_LE(previous_t_max, t_max);
+        if (t0 < t_max) {
+          EXPECT_LT(0 * Metre,
+                    (moon->EvaluatePosition(t_max) - ICRS::origin).Norm());
+        }
+        previous_t_max = t_max;
+      }
+    });
+  }
+  ephemeris.RequestProlongation(t_final);
+  EXPECT_OK(ephemeris.Prolong(Barycentre({t0_, t_final})));
+  EXPECT_OK(ephemeris.Prolong(t_final));
+  done = true;
+  for (auto& reader : readers) {
+    reader.join();
+  }
+  EXPECT_LE(t_final, ephemeris.t_max());
+}
+
 TEST_P(EphemerisTest, FlowWithAdaptiveStepSpecialCase) {
   Length const distance = 1e9 * Metre;
   Speed const velocity = 1e3 * Metre / Second;
@@ -256,6 +359,67 @@ TEST_P(EphemerisTest, FlowWithAdaptiveStepSpecialCase) {
       Ephemeris<ICRS>::unlimited_max_ephemeris_steps));
 }
 
+// Check that the first step of a flow is the one given by the parameters, if
+// any.
+TEST_P(EphemerisTest, FlowWithAdaptiveStepFirstTimeStep) {
+  Length const distance = 1e9 * Metre;
+  Speed const velocity = 1e3 * Metre / Second;
+  std::vector<not_null<std::unique_ptr<MassiveBody const>>> bodies;
+  std::vector<DegreesOfFreedom<ICRS>> initial_state;
+  Position<ICRS> centre_of_mass;
+  Time period;
+  SetUpEarthMoonSystem(bodies, initial_state, centre_of_mass, period);
+
+  Position<ICRS> const earth_position = initial_state[0].position();
+
+  Ephemeris<ICRS> ephemeris(
+      std::move(bodies),
+      initial_state,
+      t0_,
+      /*accuracy_parameters=*/{/*fitting_tolerance=*/5 * Milli(Metre),
+                               /*geopotential_tolerance=*/0x1p-24},
+      Ephemeris<ICRS>::FixedStepParameters(integrator(), period / 100));
+
+  Ephemeris<ICRS>::AdaptiveStepParameters adaptive_step_parameters(
+      EmbeddedExplicitRungeKuttaNyströmIntegrator<
+          DormandالمكاوىPrince1986RKN434FM,
+          Ephemeris<ICRS>::NewtonianMotionEquation>(),
+      max_steps,
+      1 * Metre,
+      1 * Milli(Metre) / Second);
+  DegreesOfFreedom<ICRS> const initial_degrees_of_freedom(
+      earth_position + Displacement<ICRS>({0 * Metre, distance, 0 * Metre}),
+      Velocity<ICRS>({velocity, velocity, velocity}));
+
+  // Without a hint, the first step is found by the step size controller.
+  DiscreteTrajectory<ICRS> trajectory1;
+  EXPECT_OK(trajectory1.Append(t0_, initial_degrees_of_freedom));
+  EXPECT_OK(ephemeris.FlowWithAdaptiveStep(
+      &trajectory1,
+      Ephemeris<ICRS>::NoIntrinsicAcceleration,
+      t0_ + period,
+      adaptive_step_parameters,
+      Ephemeris<ICRS>::unlimited_max_ephemeris_steps));
+  Time const first_time_step1 =
+      std::next(trajectory1.begin())->time - trajectory1.begin()->time;
+  EXPECT_LT(1 * Second, first_time_step1);
+
+  // With a hint, the first step is the hint, provided that it's small enough.
+  adaptive_step_parameters.set_first_time_step(1 * Second);
+  DiscreteTrajectory<ICRS> trajectory2;
+  EXPECT_OK(trajectory2.Append(t0_, initial_degrees_of_freedom));
+  EXPECT_OK(ephemeris.FlowWithAdaptiveStep(
+      &trajectory2,
+      Ephemeris<ICRS>::NoIntrinsicAcceleration,
+      t0_ + period,
+      adaptive_step_parameters,
+      Ephemeris<ICRS>::unlimited_max_ephemeris_steps));
+  Time const first_time_step2 =
+      std::next(trajectory2.begin())->time - trajectory2.begin()->time;
+  EXPECT_THAT(first_time_step2, IsNear(1_(1) * Second));
+  EXPECT_EQ(trajectory1.back().time, trajectory2.back().time);
+}
+
 // The canonical Earth-Moon system, tuned to produce circular orbits.
 TEST_P(EphemerisTest, EarthMoon) {
   std::vector<not_null<std::unique_ptr<MassiveBody const>>> bodies;
@@ -666,6 +830,57 @@ TEST_P(EphemerisTest, Serialization) {
   EXPECT_THAT(message, EqualsProto(second_message));
 }
 
+TEST_P(EphemerisTest, ColdSerialization) {
+  std::vector<not_null<std::unique_ptr<MassiveBody const>>> bodies;
+  std::vector<DegreesOfFreedom<ICRS>> initial_state;
+  Position<ICRS> centre_of_mass;
+  Time period;
+  SetUpEarthMoonSystem(bodies, initial_state, centre_of_mass, period);
+
+  // Each polynomial covers 8 steps, so the first blocks of 64 polynomials get
+  // compressed.
+  Ephemeris<ICRS> ephemeris(
+      std::move(bodies),
+      initial_state,
+      t0_,
+      /*accuracy_parameters=*/{/*fitting_tolerance=*/5 * Milli(Metre),
+                               /*geopotential_tolerance=*/0x1p-24,
+                               /*cold_horizon=*/period},
+      Ephemeris<ICRS>::FixedStepParameters(integrator(), period / 100));
+  EXPECT_OK(ephemeris.Prolong(t0_ + 20 * period));
+
+  serialization::Ephemeris message;
+  ephemeris.WriteToMessage(&message);
+  EXPECT_EQ(period,
+            Time::ReadFromMessage(
+                message.accuracy_parameters().cold_horizon()));
+  for (auto const& trajectory : message.trajectory()) {
+    EXPECT_EQ(period, Time::ReadFromMessage(trajectory.cold_horizon()));
+  }
+
+  auto const ephemeris_read = Ephemeris<ICRS>::ReadFromMessage(
+      /*desired_t_min=*/InfiniteFuture,
+      message);
+  EXPECT_OK(ephemeris_read->Prolong(ephemeris.t_max()));
+
+  for (int i = 0; i < 2; ++i) {
+    auto const& trajectory = *ephemeris.trajectory(ephemeris.bodies()[i]);
+    auto const& trajectory_read =
+        *ephemeris_read->trajectory(ephemeris_read->bodies()[i]);
+    EXPECT_EQ(trajectory.t_min(), trajectory_read.t_min());
+    for (Instant time = trajectory.t_min();
+         time <= trajectory.t_max();
+         time += period / 30) {
+      EXPECT_EQ(trajectory.EvaluateDegreesOfFreedom(time),
+                trajectory_read.EvaluateDegreesOfFreedom(time));
+    }
+  }
+
+  serialization::Ephemeris second_message;
+  ephemeris_read->WriteToMessage(&second_message);
+  EXPECT_THAT(message, EqualsProto(second_message));
+}
+
 // The gravitational acceleration on an elephant located at the pole.
 TEST_P(EphemerisTest, ComputeGravitationalAccelerationMasslessBody) {
   Time const duration = 1 * Second;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <optional>
+#include <vector>
 
 #include "base/not_null.hpp"
 #include "geometry/frame.hpp"
@@ -80,6 +81,17 @@ class EulerSolver {
       Instant const& time,
       DegreesOfFreedom<InertialFrame> const& linear_motion) const;
 
+  // Equivalent to calling |MotionAt| for |time| on each of the |solvers| with
+  // the corresponding element of |linear_motions|, but the elliptic functions
+  // and integrals of all the solvers are evaluated in one pass, and the
+  // argument of the Jacobi elliptic functions is reduced once per solver
+  // instead of three times.  The results may differ from those of |MotionAt|
+  // by a few ULPs.
+  static std::vector<RigidMotion<PrincipalAxesFrame, InertialFrame>> MotionsAt(
+      std::vector<not_null<EulerSolver const*>> const& solvers,
+      Instant const& time,
+      std::vector<DegreesOfFreedom<InertialFrame>> const& linear_motions);
+
   void WriteToMessage(not_null<serialization::EulerSolver*> message) const;
   static EulerSolver ReadFromMessage(serialization::EulerSolver const& message);
 
@@ -114,6 +126,31 @@ class EulerSolver {
     Motionless,
   };
 
+  // The implementations of |AngularMomentumAt| and |AttitudeAt| given the
+  // values of sn, cn, dn and of Π(φ, n|m) for the argument λΔt - ν, where φ is
+  // the Jacobi amplitude.  These values are only used by formulæ (i) and (ii)
+  // and may be NaN for the other formulæ.
+  Bivector<AngularMomentum, PrincipalAxesFrame> AngularMomentumAt(
+      Instant const& time,
+      double sn,
+      double cn,
+      double dn) const;
+  AttitudeRotation AttitudeAt(
+      Bivector<AngularMomentum, PrincipalAxesFrame> const& angular_momentum,
+      Instant const& time,
+      double sn,
+      double cn,
+      Angle const& elliptic_Π) const;
+
+  RigidMotion<PrincipalAxesFrame, InertialFrame> MotionFor(
+      Bivector<AngularMomentum, PrincipalAxesFrame> const& angular_momentum,
+      AttitudeRotation const& attitude,
+      DegreesOfFreedom<InertialFrame> const& linear_motion) const;
+
+  // True if the solver uses formula (i) or (ii), and therefore needs the
+  // Jacobi elliptic functions.
+  bool UsesEllipticFunctions() const;
+
   Rotation<PreferredPrincipalAxesFrame, ℬₜ> Compute𝒫ₜ(
       PreferredAngularMomentumBivector const& angular_momentum) const;
 
@@ -3,6 +3,8 @@
 #include "physics/euler_solver.hpp"
 
 #include <algorithm>
+#include <cstdint>
+#include <vector>
 
 #include "geometry/orthogonal_map.hpp"
 #include "geometry/quaternion.hpp"
@@ -262,22 +264,30 @@ template<typename InertialFrame, typename PrincipalAxesFrame>
 Bivector<AngularMomentum, PrincipalAxesFrame>
 EulerSolver<InertialFrame, PrincipalAxesFrame>::AngularMomentumAt(
     Instant const& time) const {
+  double sn = NaN<double>;
+  double cn = NaN<double>;
+  double dn = NaN<double>;
+  if (UsesEllipticFunctions()) {
+    JacobiSNCNDN(λ_ * (time - initial_time_) - ν_, mc_, sn, cn, dn);
+  }
+  return AngularMomentumAt(time, sn, cn, dn);
+}
+
+template<typename InertialFrame, typename PrincipalAxesFrame>
+Bivector<AngularMomentum, PrincipalAxesFrame>
+EulerSolver<InertialFrame, PrincipalAxesFrame>::AngularMomentumAt(
+    Instant const& time,
+    double const sn,
+    double const cn,
+    double const dn) const {
   Time const Δt = time - initial_time_;
   PreferredAngularMomentumBivector m;
   switch (formula_) {
     case Formula::i: {
-      double sn;
-      double cn;
-      double dn;
-      JacobiSNCNDN(λ_ * Δt - ν_, mc_, sn, cn, dn);
       m = PreferredAngularMomentumBivector({B₁₃_ * dn, -B₂₁_ * sn, B₃₁_ * cn});
       break;
     }
     case Formula::ii: {
-      double sn;
-      double cn;
-      double dn;
-      JacobiSNCNDN(λ_ * Δt - ν_, mc_, sn, cn, dn);
       m = PreferredAngularMomentumBivector({B₁₃_ * cn, -B₂₃_ * sn, B₃₁_ * dn});
       break;
     }
@@ -320,31 +330,36 @@ typename EulerSolver<InertialFrame, PrincipalAxesFrame>::AttitudeRotation
 EulerSolver<InertialFrame, PrincipalAxesFrame>::AttitudeAt(
     Bivector<AngularMomentum, PrincipalAxesFrame> const& angular_momentum,
     Instant const& time) const {
+  double sn = NaN<double>;
+  double cn = NaN<double>;
+  Angle elliptic_Π = NaN<Angle>;
+  if (UsesEllipticFunctions()) {
+    Angle const u = λ_ * (time - initial_time_) - ν_;
+    double dn;
+    JacobiSNCNDN(u, mc_, sn, cn, dn);
+    Angle const φ = JacobiAmplitude(u, mc_);
+    elliptic_Π = EllipticΠ(φ, n_, mc_);
+  }
+  return AttitudeAt(angular_momentum, time, sn, cn, elliptic_Π);
+}
+
+template<typename InertialFrame, typename PrincipalAxesFrame>
+typename EulerSolver<InertialFrame, PrincipalAxesFrame>::AttitudeRotation
+EulerSolver<InertialFrame, PrincipalAxesFrame>::AttitudeAt(
+    Bivector<AngularMomentum, PrincipalAxesFrame> const& angular_momentum,
+    Instant const& time,
+    double const sn,
+    double const cn,
+    Angle const& elliptic_Π) const {
   Rotation<PreferredPrincipalAxesFrame, ℬₜ> const 𝒫ₜ =
       Compute𝒫ₜ(𝒮_(angular_momentum));
 
   Time const Δt = time - initial_time_;
   Angle ψ = ψ_t_multiplier_ * Δt;
   switch (formula_) {
-    case Formula::i: {
-      double sn;
-      double cn;
-      double dn;
-      JacobiSNCNDN(λ_ * Δt - ν_, mc_, sn, cn, dn);
-      Angle const φ = JacobiAmplitude(λ_ * Δt - ν_, mc_);
-      ψ += ψ_elliptic_pi_multiplier_ * EllipticΠ(φ, n_, mc_) +
-           ψ_arctan_multiplier_ *
-               ArcTan(ψ_sn_multiplier_ * sn, ψ_cn_multiplier_ * cn) -
-           ψ_offset_;
-      break;
-    }
+    case Formula::i:
     case Formula::ii: {
-      double sn;
-      double cn;
-      double dn;
-      JacobiSNCNDN(λ_ * Δt - ν_, mc_, sn, cn, dn);
-      Angle const φ = JacobiAmplitude(λ_ * Δt - ν_, mc_);
-      ψ += ψ_elliptic_pi_multiplier_ * EllipticΠ(φ, n_, mc_) +
+      ψ += ψ_elliptic_pi_multiplier_ * elliptic_Π +
            ψ_arctan_multiplier_ *
                ArcTan(ψ_sn_multiplier_ * sn, ψ_cn_multiplier_ * cn) -
            ψ_offset_;
@@ -406,16 +421,64 @@ EulerSolver<InertialFrame, PrincipalAxesFrame>::MotionAt(
       AngularMomentumAt(time);
   Rotation<PrincipalAxesFrame, InertialFrame> const attitude =
       AttitudeAt(angular_momentum, time);
-  AngularVelocity<InertialFrame> const angular_velocity =
-      attitude(AngularVelocityFor(angular_momentum));
+  return MotionFor(angular_momentum, attitude, linear_motion);
+}
 
-  return RigidMotion<PrincipalAxesFrame, InertialFrame>(
-      RigidTransformation<PrincipalAxesFrame, InertialFrame>(
-          PrincipalAxesFrame::origin,
-          linear_motion.position(),
-          attitude.template Forget<OrthogonalMap>()),
-      angular_velocity,
-      linear_motion.velocity());
+template<typename InertialFrame, typename PrincipalAxesFrame>
+std::vector<RigidMotion<PrincipalAxesFrame, InertialFrame>>
+EulerSolver<InertialFrame, PrincipalAxesFrame>::MotionsAt(
+    std::vector<not_null<EulerSolver const*>> const& solvers,
+    Instant const& time,
+    std::vector<DegreesOfFreedom<InertialFrame>> const& linear_motions) {
+  CHECK_EQ(solvers.size(), linear_motions.size());
+
+  // Gather the arguments of the elliptic functions and integrals for all the
+  // solvers that need them, and evaluate them in one pass.
+  std::vector<Angle> u;
+  std::vector<double> n;
+  std::vector<double> mc;
+  for (not_null<EulerSolver const*> const solver : solvers) {
+    if (solver->UsesEllipticFunctions()) {
+      u.push_back(solver->λ_ * (time - solver->initial_time_) - solver->ν_);
+      n.push_back(solver->n_);
+      mc.push_back(solver->mc_);
+    }
+  }
+  std::vector<double> sn;
+  std::vector<double> cn;
+  std::vector<double> dn;
+  std::vector<Angle> φ;
+  JacobiSNCNDNAmplitude(u, mc, sn, cn, dn, φ);
+  std::vector<Angle> B;
+  std::vector<Angle> D;
+  std::vector<Angle> J;
+  FukushimaEllipticBDJ(φ, n, mc, B, D, J);
+
+  std::vector<RigidMotion<PrincipalAxesFrame, InertialFrame>> motions;
+  motions.reserve(solvers.size());
+  std::int64_t j = 0;
+  for (std::int64_t i = 0; i < solvers.size(); ++i) {
+    EulerSolver const& solver = *solvers[i];
+    double sn_i = NaN<double>;
+    double cn_i = NaN<double>;
+    double dn_i = NaN<double>;
+    Angle elliptic_Π = NaN<Angle>;
+    if (solver.UsesEllipticFunctions()) {
+      sn_i = sn[j];
+      cn_i = cn[j];
+      dn_i = dn[j];
+      // This is how |EllipticΠ| computes Π(φ, n|m) from B, D and J.
+      elliptic_Π = (B[j] + D[j]) + n[j] * J[j];
+      ++j;
+    }
+    Bivector<AngularMomentum, PrincipalAxesFrame> const angular_momentum =
+        solver.AngularMomentumAt(time, sn_i, cn_i, dn_i);
+    AttitudeRotation const attitude =
+        solver.AttitudeAt(angular_momentum, time, sn_i, cn_i, elliptic_Π);
+    motions.push_back(
+        solver.MotionFor(angular_momentum, attitude, linear_motions[i]));
+  }
+  return motions;
 }
 
 template<typename InertialFrame, typename PrincipalAxesFrame>
@@ -440,6 +503,30 @@ EulerSolver<InertialFrame, PrincipalAxesFrame>::ReadFromMessage(
       Instant::ReadFromMessage(message.initial_time()));
 }
 
+template<typename InertialFrame, typename PrincipalAxesFrame>
+RigidMotion<PrincipalAxesFrame, InertialFrame>
+EulerSolver<InertialFrame, PrincipalAxesFrame>::MotionFor(
+    Bivector<AngularMomentum, PrincipalAxesFrame> const& angular_momentum,
+    AttitudeRotation const& attitude,
+    DegreesOfFreedom<InertialFrame> const& linear_motion) const {
+  AngularVelocity<InertialFrame> const angular_velocity =
+      attitude(AngularVelocityFor(angular_momentum));
+
+  return RigidMotion<PrincipalAxesFrame, InertialFrame>(
+      RigidTransformation<PrincipalAxesFrame, InertialFrame>(
+          PrincipalAxesFrame::origin,
+          linear_motion.position(),
+          attitude.template Forget<OrthogonalMap>()),
+      angular_velocity,
+      linear_motion.velocity());
+}
+
+template<typename InertialFrame, typename PrincipalAxesFrame>
+bool EulerSolver<InertialFrame, PrincipalAxesFrame>::UsesEllipticFunctions()
+    const {
+  return formula_ == Formula::i || formula_ == Formula::ii;
+}
+
 template<typename InertialFrame, typename PrincipalAxesFrame>
 Rotation<typename EulerSolver<InertialFrame,
                               PrincipalAxesFrame>::PreferredPrincipalAxesFrame,
@@ -9,6 +9,7 @@
 
 #include "astronomy/frames.hpp"
 #include "astronomy/time_scales.hpp"
+#include "base/not_null.hpp"
 #include "geometry/frame.hpp"
 #include "geometry/grassmann.hpp"
 #include "geometry/instant.hpp"
@@ -17,6 +18,8 @@
 #include "geometry/rotation.hpp"
 #include "geometry/space.hpp"
 #include "gtest/gtest.h"
+#include "physics/degrees_of_freedom.hpp"
+#include "physics/rigid_motion.hpp"
 #include "quantities/elementary_functions.hpp"
 #include "quantities/named_quantities.hpp"
 #include "quantities/quantities.hpp"
@@ -39,6 +42,7 @@ using ::testing::Lt;
 using ::testing::Matcher;
 using namespace principia::astronomy::_frames;
 using namespace principia::astronomy::_time_scales;
+using namespace principia::base::_not_null;
 using namespace principia::geometry::_frame;
 using namespace principia::geometry::_grassmann;
 using namespace principia::geometry::_instant;
@@ -46,7 +50,9 @@ using namespace principia::geometry::_permutation;
 using namespace principia::geometry::_r3_element;
 using namespace principia::geometry::_rotation;
 using namespace principia::geometry::_space;
+using namespace principia::physics::_degrees_of_freedom;
 using namespace principia::physics::_euler_solver;
+using namespace principia::physics::_rigid_motion;
 using namespace principia::quantities::_elementary_functions;
 using namespace principia::quantities::_named_quantities;
 using namespace principia::quantities::_quantities;
@@ -1156,6 +1162,87 @@ TEST_F(EulerSolverTest, Toutatis) {
   }
 }
 
+// Check that the batch computation of the motions agrees with the computation
+// for each solver.
+TEST_F(EulerSolverTest, MotionsAt) {
+  std::mt19937_64 random(42);
+  std::uniform_real_distribution<> moment_of_inertia_distribution(0.0, 10.0);
+  std::uniform_real_distribution<> angular_momentum_distribution(-10.0, 10.0);
+
+  std::vector<Solver> solvers;
+  solvers.reserve(102);
+  for (int i = 0; i < 100; ++i) {
+    std::array<double, 3> randoms{moment_of_inertia_distribution(random),
+                                  moment_of_inertia_distribution(random),
+                                  moment_of_inertia_distribution(random)};
+    std::sort(randoms.begin(), randoms.end());
+    R3Element<MomentOfInertia> const moments_of_inertia{
+        randoms[0] * si::Unit<MomentOfInertia>,
+        randoms[1] * si::Unit<MomentOfInertia>,
+        randoms[2] * si::Unit<MomentOfInertia>};
+    Bivector<AngularMomentum, PrincipalAxes> const initial_angular_momentum(
+        {angular_momentum_distribution(random) * si::Unit<AngularMomentum>,
+         angular_momentum_distribution(random) * si::Unit<AngularMomentum>,
+         angular_momentum_distribution(random) * si::Unit<AngularMomentum>});
+    solvers.emplace_back(moments_of_inertia,
+                         identity_attitude_(initial_angular_momentum),
+                         identity_attitude_,
+                         Instant() + i * Second);
+  }
+
+  // A sphere and a symmetric top, which don't use elliptic functions.
+  R3Element<MomentOfInertia> const sphere_moments_of_inertia{
+      3.0 * si::Unit<MomentOfInertia>,
+      3.0 * si::Unit<MomentOfInertia>,
+      3.0 * si::Unit<MomentOfInertia>};
+  R3Element<MomentOfInertia> const symmetric_moments_of_inertia{
+      3.0 * si::Unit<MomentOfInertia>,
+      3.0 * si::Unit<MomentOfInertia>,
+      9.0 * si::Unit<MomentOfInertia>};
+  Bivector<AngularMomentum, ICRS> const angular_momentum(
+      {1.0 * si::Unit<AngularMomentum>,
+       2.0 * si::Unit<AngularMomentum>,
+       3.0 * si::Unit<AngularMomentum>});
+  solvers.emplace_back(sphere_moments_of_inertia,
+                       angular_momentum,
+                       identity_attitude_,
+                       Instant());
+  solvers.emplace_back(symmetric_moments_of_inertia,
+                       angular_momentum,
+                       identity_attitude_,
+                       Instant());
+
+  std::vector<not_null<Solver const*>> solver_pointers;
+  for (auto const& solver : solvers) {
+    solver_pointers.push_back(&solver);
+  }
+  DegreesOfFreedom<ICRS> const linear_motion(
+      ICRS::origin + Displacement<ICRS>({1 * Metre, 2 * Metre, 3 * Metre}),
+      Velocity<ICRS>(
+          {4 * Metre / Second, 5 * Metre / Second, 6 * Metre / Second}));
+  std::vector<DegreesOfFreedom<ICRS>> const linear_motions(solvers.size(),
+                                                           linear_motion);
+
+  for (Time const& Δt : {0 * Second, 1 * Second, 100 * Second, 1000 * Second}) {
+    Instant const t = Instant() + Δt;
+    auto const motions = Solver::MotionsAt(solver_pointers, t, linear_motions);
+    ASSERT_EQ(solvers.size(), motions.size());
+    for (int i = 0; i < solvers.size(); ++i) {
+      auto const expected = solvers[i].MotionAt(t, linear_motion);
+      auto const& actual = motions[i];
+      EXPECT_THAT(RelativeError(expected.angular_velocity_of<PrincipalAxes>(),
+                                actual.angular_velocity_of<PrincipalAxes>()),
+                  Lt(1e-10)) << i << " " << t;
+      EXPECT_THAT(AngleBetween(actual.orthogonal_map()(e1_),
+                               expected.orthogonal_map()(e1_)),
+                  Lt(1e-10 * Radian)) << i << " " << t;
+      EXPECT_THAT(AngleBetween(actual.orthogonal_map()(e2_),
+                               expected.orthogonal_map()(e2_)),
+                  Lt(1e-10 * Radian)) << i << " " << t;
+    }
+  }
+}
+
 TEST_F(EulerSolverTest, Serialization) {
   R3Element<MomentOfInertia> const moments_of_inertia{
       3.0 * si::Unit<MomentOfInertia>,
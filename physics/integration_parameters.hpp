@@ -48,7 +48,15 @@ class AdaptiveStepParameters final {
            std::enable_if_t<E::order == 2, std::nullptr_t> = nullptr>
   Speed speed_integration_tolerance() const;
 
+  // If present, the size of the first step attempted by a flow using these
+  // parameters, typically the step size accepted by an earlier flow through
+  // similar dynamics.  If absent, the first step attempted covers the entire
+  // flow, and the step size controller reduces it as needed.  This hint is not
+  // serialized.
+  std::optional<Time> const& first_time_step() const;
+
   void set_max_steps(std::int64_t max_steps);
+  void set_first_time_step(std::optional<Time> const& first_time_step);
   void set_length_integration_tolerance(
       Length const& length_integration_tolerance);
   template<typename E = ODE,
@@ -67,6 +75,7 @@ class AdaptiveStepParameters final {
   std::int64_t max_steps_;
   Length length_integration_tolerance_;
   std::optional<Speed> speed_integration_tolerance_;
+  std::optional<Time> first_time_step_;
 };
 
 template<typename ODE>
@@ -61,6 +61,12 @@ Speed AdaptiveStepParameters<ODE>::speed_integration_tolerance() const {
   return speed_integration_tolerance_.value();
 }
 
+template<typename ODE>
+std::optional<Time> const& AdaptiveStepParameters<ODE>::first_time_step()
+    const {
+  return first_time_step_;
+}
+
 template<typename ODE>
 void AdaptiveStepParameters<ODE>::set_max_steps(std::int64_t const max_steps) {
   CHECK_LT(0, max_steps);
@@ -80,6 +86,15 @@ void AdaptiveStepParameters<ODE>::set_speed_integration_tolerance(
   speed_integration_tolerance_ = speed_integration_tolerance;
 }
 
+template<typename ODE>
+void AdaptiveStepParameters<ODE>::set_first_time_step(
+    std::optional<Time> const& first_time_step) {
+  if (first_time_step.has_value()) {
+    CHECK_LT(Time(), first_time_step.value());
+  }
+  first_time_step_ = first_time_step;
+}
+
 template<typename ODE>
 void AdaptiveStepParameters<ODE>::WriteToMessage(
     not_null<serialization::AdaptiveStepParameters*> const message) const {
@@ -48,6 +48,7 @@ class MockEphemeris : public Ephemeris<Frame> {
               Prolong,
               (Instant const& t, std::int64_t max_ephemeris_steps),
               (override));
+  MOCK_METHOD(void, RequestProlongation, (Instant const& t), (override));
   MOCK_METHOD(
       not_null<std::unique_ptr<
           typename Integrator<NewtonianMotionEquation>::Instance>>,
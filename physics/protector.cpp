@@ -1,56 +1,145 @@
 #include "physics/protector.hpp"
 
-#include <optional>
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <thread>
 #include <utility>
 #include <vector>
 
+#include "glog/logging.h"
+#include "quantities/si.hpp"
+
 namespace principia {
 namespace physics {
 namespace _protector {
 namespace internal {
 
+using namespace principia::quantities::_si;
+
+namespace {
+
+double ToSeconds(Instant const& t) {
+  return (t - Instant()) / Second;
+}
+
+}  // namespace
+
+Protector::Shard::Shard()
+    : earliest_start_time(std::numeric_limits<double>::infinity()) {}
+
 bool Protector::RunWhenUnprotected(Instant const& t, Callback callback) {
+  if (t <= EarliestProtectionStartTime()) {
+    callback();
+    return true;
+  }
   {
-    absl::MutexLock l(&lock_);
-    if (!protection_start_times_.empty() &&
-        *protection_start_times_.begin() < t) {
-      callbacks_.emplace(t, std::move(callback));
-      return false;
-    }
+    absl::MutexLock l(&callbacks_lock_);
+    callbacks_.emplace(t, std::move(callback));
+    ++number_of_callbacks_;
   }
-  callback();
-  return true;
+  // The range may have become unprotected after we looked at it and before
+  // the callback was visible to |Unprotect|.  Both this thread and the one
+  // calling |Unprotect| use sequentially consistent atomics, so at least one of
+  // them will see that the callback can run.
+  RunUnprotectedCallbacks();
+  return false;
 }
 
 void Protector::Protect(Instant const& t_min) {
-  absl::MutexLock l(&lock_);
-  protection_start_times_.insert(t_min);
+  Shard& shard = ThisThreadShard();
+  absl::MutexLock l(&shard.lock);
+  shard.protection_start_times.push_back(t_min);
+  Publish(shard);
 }
 
 void Protector::Unprotect(Instant const& t_min) {
+  // Look first in the shard of this thread, which is where the protection is,
+  // unless it was created by another thread.
+  Shard& this_thread_shard = ThisThreadShard();
+  bool found = false;
+  for (int i = 0; i <= number_of_shards && !found; ++i) {
+    Shard& shard = i == 0 ? this_thread_shard : shards_[i - 1];
+    if (i > 0 && &shard == &this_thread_shard) {
+      continue;
+    }
+    absl::MutexLock l(&shard.lock);
+    auto& times = shard.protection_start_times;
+    auto const it = std::find(times.begin(), times.end(), t_min);
+    if (it != times.end()) {
+      *it = times.back();
+      times.pop_back();
+      Publish(shard);
+      found = true;
+    }
+  }
+  CHECK(found) << t_min;
+
+  if (number_of_callbacks_ > 0) {
+    RunUnprotectedCallbacks();
+  }
+}
+
+Protector::Shard& Protector::ThisThreadShard() {
+  thread_local std::size_t const shard_index =
+      std::hash<std::thread::id>()(std::this_thread::get_id()) %
+      number_of_shards;
+  return shards_[shard_index];
+}
+
+void Protector::Publish(Shard& shard) {
+  double earliest_start_time = std::numeric_limits<double>::infinity();
+  for (Instant const& t : shard.protection_start_times) {
+    earliest_start_time = std::min(earliest_start_time, ToSeconds(t));
+  }
+  ++shard.version;
+  shard.earliest_start_time = earliest_start_time;
+  ++shard.version;
+}
+
+Instant Protector::EarliestProtectionStartTime() const {
+  // A double collect: if the versions of the shards have not changed between
+  // two successive reads, the values read in-between form a snapshot of the
+  // state of the protector at some point between the two reads.  Otherwise, a
+  // protection could have been moved from one shard to another (by protecting
+  // the new range before unprotecting the old one) and we would miss it.
+  std::array<std::int64_t, number_of_shards> versions;
+  for (;;) {
+    double earliest_start_time = std::numeric_limits<double>::infinity();
+    bool consistent = true;
+    for (int i = 0; i < number_of_shards; ++i) {
+      versions[i] = shards_[i].version;
+      if (versions[i] % 2 != 0) {
+        consistent = false;
+        break;
+      }
+      earliest_start_time =
+          std::min(earliest_start_time, shards_[i].earliest_start_time.load());
+    }
+    for (int i = 0; i < number_of_shards && consistent; ++i) {
+      consistent = shards_[i].version == versions[i];
+    }
+    if (consistent) {
+      return Instant() + earliest_start_time * Second;
+    }
+    std::this_thread::yield();
+  }
+}
+
+void Protector::RunUnprotectedCallbacks() {
   std::vector<Callback> callbacks_to_run;
   {
-    absl::MutexLock l(&lock_);
-    auto const it = protection_start_times_.find(t_min);
-    CHECK(it != protection_start_times_.end());
-    protection_start_times_.erase(it);
-
+    absl::MutexLock l(&callbacks_lock_);
     // Find all the callbacks that are now unprotected and remove them from the
     // multimap.
-    std::optional<Instant> const first_guard_start_time =
-        protection_start_times_.empty()
-            ? std::nullopt
-            : std::make_optional(*protection_start_times_.begin());
-    for (auto it = callbacks_.begin(); it != callbacks_.end();) {
-      auto const& t = it->first;
-      auto& callback = it->second;
-      if (!first_guard_start_time || t <= *first_guard_start_time) {
-        callbacks_to_run.emplace_back(std::move(callback));
-        it = callbacks_.erase(it);
-      } else {
-        ++it;
-      }
+    Instant const earliest_protection_start_time =
+        EarliestProtectionStartTime();
+    for (auto it = callbacks_.begin();
+         it != callbacks_.end() && it->first <= earliest_protection_start_time;
+         it = callbacks_.erase(it)) {
+      callbacks_to_run.emplace_back(std::move(it->second));
     }
+    number_of_callbacks_ = static_cast<std::int64_t>(callbacks_.size());
   }
 
   // Run the callbacks without holding the lock.
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <cstdint>
 #include <functional>
-#include <set>
 #include <map>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/synchronization/mutex.h"
@@ -21,6 +24,12 @@ using namespace principia::geometry::_instant;
 // would want to touch the time range ]-∞, t[ should do so through
 // RunWhenUnprotected, and the change will be delayed until ]-∞, t[ becomes
 // unprotected.  This class is thread-safe.
+//
+// Protections are recorded in shards selected by the calling thread, and each
+// shard publishes the start of its earliest protection atomically, in the
+// manner of hazard pointers.  Therefore, threads that protect and unprotect
+// concurrently don't contend with each other, and |RunWhenUnprotected| only
+// takes a lock when it must delay its callback.
 class Protector {
  public:
   // A callback that may be run immediately or in a delayed manner when the
@@ -33,14 +42,51 @@ class Protector {
   // callbacks are run without any lock held, in time order.
   bool RunWhenUnprotected(Instant const& t, Callback callback);
 
-  // Protects and unprotects the time range [t_min, +∞[.
+  // Protects and unprotects the time range [t_min, +∞[.  A range may be
+  // unprotected by a thread other than the one that protected it.
   void Protect(Instant const& t_min);
   void Unprotect(Instant const& t_min);
 
  private:
-  absl::Mutex lock_;
-  std::multimap<Instant, Callback> callbacks_ GUARDED_BY(lock_);
-  std::multiset<Instant> protection_start_times_ GUARDED_BY(lock_);
+  static constexpr int number_of_shards = 16;
+
+  // Aligned to avoid false sharing between the threads that use different
+  // shards.
+  struct alignas(64) Shard {
+    absl::Mutex lock;
+    // Unordered, and only growing, to avoid allocations once the protector
+    // has warmed up.
+    std::vector<Instant> protection_start_times GUARDED_BY(lock);
+    // A sequence lock for the lock-free readers of |earliest_start_time|: it is
+    // odd while |earliest_start_time| is being updated.
+    std::atomic<std::int64_t> version = 0;
+    // The earliest of the |protection_start_times|, or +∞ if there are none,
+    // in seconds since |Instant()|.
+    std::atomic<double> earliest_start_time;
+
+    Shard();
+  };
+
+  Shard& ThisThreadShard();
+
+  // Publishes the |earliest_start_time| of |shard| after its
+  // |protection_start_times| have changed.
+  static void Publish(Shard& shard) REQUIRES(shard.lock);
+
+  // Returns the earliest start time of all the protections, from a consistent
+  // snapshot of the shards.  Does not take any lock.
+  Instant EarliestProtectionStartTime() const;
+
+  // Runs the delayed callbacks whose time range has become unprotected.
+  void RunUnprotectedCallbacks();
+
+  std::array<Shard, number_of_shards> shards_;
+
+  // Only used when callbacks must be delayed.
+  absl::Mutex callbacks_lock_;
+  std::multimap<Instant, Callback> callbacks_ GUARDED_BY(callbacks_lock_);
+  // The size of |callbacks_|, readable without taking |callbacks_lock_|.
+  std::atomic<std::int64_t> number_of_callbacks_ = 0;
 };
 
 }  // namespace internal
@@ -1,5 +1,9 @@
 #include "physics/protector.hpp"
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 #include "geometry/instant.hpp"
 #include "glog/logging.h"
 #include "gmock/gmock.h"
@@ -39,5 +43,34 @@ TEST_F(ProtectorTest, DelayedExecution) {
   protector_.Unprotect(Instant() + 10 * Second);
 }
 
+TEST_F(ProtectorTest, Concurrency) {
+  std::atomic<int> callbacks_run = 0;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 8; ++i) {
+    threads.emplace_back([this, i, &callbacks_run]() {
+      // Hand over the protection from one range to the next, as a reader
+      // progressing along a timeline would do, and try to touch the timeline
+      // behind us.
+      Instant t_min = Instant() + i * Second;
+      protector_.Protect(t_min);
+      for (int j = 0; j < 1000; ++j) {
+        Instant const next_t_min = t_min + 1 * Second;
+        protector_.Protect(next_t_min);
+        protector_.Unprotect(t_min);
+        t_min = next_t_min;
+        protector_.RunWhenUnprotected(t_min, [&callbacks_run]() {
+          ++callbacks_run;
+        });
+      }
+      protector_.Unprotect(t_min);
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  // All the callbacks have run once nothing is protected.
+  EXPECT_EQ(8 * 1000, callbacks_run);
+}
+
 }  // namespace physics
 }  // namespace principia
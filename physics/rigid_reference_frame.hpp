@@ -8,8 +8,12 @@
 #ifndef PRINCIPIA_PHYSICS_RIGID_REFERENCE_FRAME_HPP_
 #define PRINCIPIA_PHYSICS_RIGID_REFERENCE_FRAME_HPP_
 
+#include <deque>
 #include <memory>
+#include <utility>
 
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/mutex.h"
 #include "base/not_null.hpp"
 #include "geometry/frame.hpp"
 #include "geometry/grassmann.hpp"
@@ -102,6 +106,21 @@ class RigidReferenceFrame : public ReferenceFrame<InertialFrame, ThisFrame> {
                       not_null<Ephemeris<InertialFrame> const*> ephemeris);
 
  protected:
+  // Returns |compute()|, the motion of |ThisFrame| at |t|, memoized for the
+  // |memoized_motions| most recent instants.  Within a single frame the
+  // renderer, the planetarium and the navball typically request the motion of
+  // the same reference frame at the same instant many times, so the subclasses
+  // should use this function to implement |ToThisFrameAtTime| when computing
+  // the motion is expensive.  The memoized motions are never invalidated, they
+  // are simply evicted as time advances, so this function must only be used if
+  // the motion at a given instant does not change, e.g., if the frame is
+  // defined by massive bodies.  This function is thread-safe; |compute| is
+  // called without holding any lock.
+  template<typename Compute>
+  RigidMotion<InertialFrame, ThisFrame> MemoizedToThisFrameAtTime(
+      Instant const& t,
+      Compute const& compute) const;
+
   // A helper function for computing the rotational movement of a frame defined
   // by two bodies.
   static void ComputeAngularDegreesOfFreedom(
@@ -169,6 +188,8 @@ class RigidReferenceFrame : public ReferenceFrame<InertialFrame, ThisFrame> {
                              Trihedron<double, double, 2> const& 𝛛²orthonormal);
 
  private:
+  static constexpr int memoized_motions = 4;
+
   void ComputeGeometricAccelerations(
       Instant const& t,
       DegreesOfFreedom<ThisFrame> const& degrees_of_freedom,
@@ -186,6 +207,11 @@ class RigidReferenceFrame : public ReferenceFrame<InertialFrame, ThisFrame> {
       Position<InertialFrame> const& q) const = 0;
   virtual AcceleratedRigidMotion<InertialFrame, ThisFrame> MotionOfThisFrame(
       Instant const& t) const = 0;
+
+  mutable absl::Mutex memoized_motions_lock_;
+  // The most recently used motion is at the front.
+  mutable std::deque<std::pair<Instant, RigidMotion<InertialFrame, ThisFrame>>>
+      memoized_motions_ GUARDED_BY(memoized_motions_lock_);
 };
 
 }  // namespace internal
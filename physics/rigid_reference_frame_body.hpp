@@ -186,6 +186,41 @@ RigidReferenceFrame<InertialFrame, ThisFrame>::ReadFromMessage(
   return std::move(result);
 }
 
+template<typename InertialFrame, typename ThisFrame>
+template<typename Compute>
+RigidMotion<InertialFrame, ThisFrame>
+RigidReferenceFrame<InertialFrame, ThisFrame>::MemoizedToThisFrameAtTime(
+    Instant const& t,
+    Compute const& compute) const {
+  {
+    absl::MutexLock l(&memoized_motions_lock_);
+    for (auto it = memoized_motions_.begin();
+         it != memoized_motions_.end();
+         ++it) {
+      if (it->first == t) {
+        auto const motion = it->second;
+        if (it != memoized_motions_.begin()) {
+          memoized_motions_.erase(it);
+          memoized_motions_.emplace_front(t, motion);
+        }
+        return motion;
+      }
+    }
+  }
+
+  // Compute the motion without holding the lock, so that other threads may
+  // use the memoized motions in the meantime.  If another thread has computed
+  // the motion at |t| concurrently, we may end up with a duplicate entry, which
+  // is harmless.
+  RigidMotion<InertialFrame, ThisFrame> const motion = compute();
+  absl::MutexLock l(&memoized_motions_lock_);
+  memoized_motions_.emplace_front(t, motion);
+  if (memoized_motions_.size() > memoized_motions) {
+    memoized_motions_.pop_back();
+  }
+  return motion;
+}
+
 template<typename InertialFrame, typename ThisFrame>
 void RigidReferenceFrame<InertialFrame, ThisFrame>::
 ComputeAngularDegreesOfFreedom(
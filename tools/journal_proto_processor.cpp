@@ -200,9 +200,9 @@ void JournalProtoProcessor::ProcessRepeatedNonStringField(
     std::string const& cs_boxed_type,
     std::string const& cs_unboxed_type,
     std::string const& cxx_type) {
-  if (Contains(interchange_, descriptor)) {
-    // This may be null as we may be called on a scalar field.
-    Descriptor const* message_type = descriptor->message_type();
+  // This may be null as we may be called on a scalar field.
+  Descriptor const* message_type = descriptor->message_type();
+  if (Contains(interchange_, descriptor) || message_type != nullptr) {
     if (Contains(cs_custom_marshaler_name_, message_type)) {
       field_cs_custom_marshaler_[descriptor] =
           "RepeatedMarshaler<" + cs_unboxed_type + ", " +
@@ -220,7 +220,7 @@ void JournalProtoProcessor::ProcessRepeatedNonStringField(
           return {"&" + identifier + "[0]"};
         };
   } else {
-    LOG(FATAL) << "Repeated non-string types are only implemented for "
+    LOG(FATAL) << "Repeated scalar types are only implemented for "
                   "interchange messages";
   }
 }
@@ -346,9 +346,16 @@ void JournalProtoProcessor::ProcessRepeatedMessageField(
                "              " + storage_name +
                ".first.push_back(Deserialize" + message_type_name +
                "(message, pointer_map));\n" +
+               "            }\n"
+               // The pointers are only taken once |first| has stopped
+               // growing, lest they be invalidated by a reallocation.
+               "            for (auto const& value : " + storage_name +
+               ".first) {\n" +
                "              " + storage_name +
-               ".second.push_back(&" + storage_name + ".first.back());\n" +
+               ".second.push_back(&value);\n" +
                "            }\n"
+               "            " + storage_name +
+               ".second.push_back(nullptr);\n"
                "            return &" + storage_name + ".second[0];\n" +
                "          }(" + expr + ")";
       };
@@ -1840,6 +1847,10 @@ void JournalProtoProcessor::ProcessMethodExtension(
   }
   cxx_toplevel_type_declaration_[descriptor] +=
       "  using Message = serialization::" + name + ";\n";
+  // The name is a compile-time constant so that profiling an interface call
+  // does not need to go through the message descriptor.
+  cxx_toplevel_type_declaration_[descriptor] +=
+      "  static constexpr char name[] = \"" + name + "\";\n";
   if (has_in) {
     cxx_toplevel_type_declaration_[descriptor] +=
         "  static void Fill(In const& in, "